@@ -0,0 +1,280 @@
+// Arena-Pruefung (ArenaAllocator): Best-Fit-Auswahl, Verschmelzen freier Nachbarn bei release,
+// compact() mit Move-Callbacks (Reihenfolge, Ziele, Inhalt nach dem Umkopieren) und grow().
+// Danach ein Zufallslauf gegen eine Referenz Einheit fuer Einheit (Loecher, Best Fit,
+// keine Ueberlappung, Stats). Exit-Code 1 bei Abweichung.
+#include <BrickWorlds/Core/ArenaAllocator.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace BrickWorlds::Core;
+
+namespace {
+
+    using Handle = ArenaAllocator::Handle;
+
+    int failures = 0;
+
+    void Check(bool ok, const char* what) {
+        std::printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) ++failures;
+    }
+
+    void CheckBestFit() {
+        std::printf("best fit\n");
+        ArenaAllocator arena(100);
+        // 0:10 | 10:20 | 30:10 | 40:30 | 70:5 | 75:25 -> voll
+        Handle h[6];
+        const std::size_t sizes[6] = { 10, 20, 10, 30, 5, 25 };
+        for (int i = 0; i < 6; ++i) h[i] = arena.allocate(sizes[i]);
+        Check(arena.freeSpace() == 0 && arena.offset(h[5]) == 75, "arena filled front to back");
+
+        // Loecher 20 @ 10, 30 @ 40, 25 @ 75
+        arena.release(h[1]);
+        arena.release(h[3]);
+        arena.release(h[5]);
+        Check(arena.stats().freeBlocks == 3 && arena.stats().largestFree == 30, "three separate holes");
+
+        const Handle a = arena.allocate(22);
+        Check(a != ArenaAllocator::InvalidHandle && arena.offset(a) == 75, "22 goes into the 25 hole, not the 30");
+        const Handle b = arena.allocate(20);
+        Check(b != ArenaAllocator::InvalidHandle && arena.offset(b) == 10, "20 fills the 20 hole exactly");
+        const Handle c = arena.allocate(3);
+        Check(c != ArenaAllocator::InvalidHandle && arena.offset(c) == 97, "3 goes into the 3 left behind at 97");
+        const Handle d = arena.allocate(31);
+        Check(d == ArenaAllocator::InvalidHandle && arena.stats().failedAllocations == 1,
+            "31 fails with only a 30 hole left");
+
+        // Gleich grosse Loecher: niedrigster Offset gewinnt
+        ArenaAllocator ties(40);
+        Handle t[4];
+        for (Handle& x : t) x = ties.allocate(10);
+        ties.release(t[2]);
+        ties.release(t[0]);
+        const Handle e = ties.allocate(4);
+        Check(ties.offset(e) == 0, "equal holes: lowest offset first");
+    }
+
+    void CheckCoalescing() {
+        std::printf("coalescing on release\n");
+        ArenaAllocator arena(60);
+        Handle h[6];
+        for (Handle& x : h) x = arena.allocate(10);
+
+        arena.release(h[1]);
+        arena.release(h[3]);
+        Check(arena.stats().freeBlocks == 2 && arena.stats().largestFree == 10, "non-adjacent holes stay apart");
+        arena.release(h[2]);
+        Check(arena.stats().freeBlocks == 1 && arena.stats().largestFree == 30, "merged with left and right neighbour");
+        arena.release(h[5]);
+        Check(arena.stats().freeBlocks == 2 && arena.stats().largestFree == 30, "hole at the end stays apart");
+        arena.release(h[4]);
+        Check(arena.stats().freeBlocks == 1 && arena.stats().largestFree == 50, "bridging block joins both holes");
+        const Handle big = arena.allocate(50);
+        Check(big != ArenaAllocator::InvalidHandle && arena.offset(big) == 10, "merged hole usable as one block");
+        arena.release(big);
+        arena.release(h[0]);
+        Check(arena.stats().freeBlocks == 1 && arena.stats().largestFree == 60 && arena.stats().used == 0,
+            "empty arena is one free block");
+        Check(arena.stats().fragmentation() == 0.0, "no fragmentation when empty");
+
+        arena.release(h[0]);
+        arena.release(ArenaAllocator::InvalidHandle);
+        Check(arena.stats().freeBlocks == 1 && arena.freeSpace() == 60, "double release and InvalidHandle ignored");
+    }
+
+    // Inhalt jeder Einheit = Handle + 1, 0 = frei
+    void Write(std::vector<int>& buffer, const ArenaAllocator& arena, Handle h) {
+        for (std::size_t i = 0; i < arena.size(h); ++i) buffer[arena.offset(h) + i] = int(h) + 1;
+    }
+
+    void CheckCompact() {
+        std::printf("compact\n");
+        ArenaAllocator arena(200);
+        std::vector<int> buffer(200, 0);
+        std::vector<Handle> live;
+        for (std::size_t i = 0; i < 12; ++i) {
+            const Handle h = arena.allocate(3 + i * 2);
+            Write(buffer, arena, h);
+            live.push_back(h);
+        }
+        // Jeden zweiten und den ersten freigeben -> Loecher vorne, in der Mitte und hinten
+        for (std::size_t i = 0; i < live.size(); i += 2) arena.release(live[i]);
+        std::vector<Handle> kept;
+        for (std::size_t i = 1; i < live.size(); i += 2) kept.push_back(live[i]);
+        Check(arena.stats().fragmentation() > 0.0, "fragmented before compact");
+
+        // In einen frischen Buffer umkopieren, wie der Client
+        std::vector<int> fresh(200, 0);
+        std::vector<int> calls(live.size() + 1, 0);
+        std::size_t lastFrom = 0, nextTo = 0, callCount = 0;
+        bool ordered = true, contiguous = true, sized = true, tagged = true;
+        arena.compact([&](Handle h, std::size_t from, std::size_t to, std::size_t size) {
+            ordered &= callCount == 0 || from > lastFrom;
+            contiguous &= to == nextTo;
+            sized &= size == arena.size(h);
+            for (std::size_t i = 0; i < size; ++i) {
+                tagged &= buffer[from + i] == int(h) + 1;
+                fresh[to + i] = buffer[from + i];
+            }
+            if (h < calls.size()) ++calls[h];
+            lastFrom = from;
+            nextTo = to + size;
+            ++callCount;
+        });
+
+        bool once = callCount == kept.size();
+        for (Handle h : kept) once &= calls[h] == 1;
+        Check(once, "one callback per live allocation");
+        Check(ordered, "callbacks in offset order");
+        Check(contiguous, "targets packed from 0 without gaps");
+        Check(sized && tagged, "sizes and source ranges match the handles");
+
+        bool moved = true;
+        for (Handle h : kept)
+            for (std::size_t i = 0; i < arena.size(h); ++i) moved &= fresh[arena.offset(h) + i] == int(h) + 1;
+        Check(moved, "offset() after compact points at the copied data");
+
+        const ArenaAllocator::Stats& s = arena.stats();
+        Check(s.freeBlocks == 1 && s.largestFree == s.capacity - s.used && s.fragmentation() == 0.0,
+            "free space is one block at the end");
+        Check(s.compactions == 1 && s.movedUnits > 0 && s.movedUnits <= s.used, "compaction and moved units counted");
+        const std::size_t packedEnd = s.used;
+        const Handle rest = arena.allocate(arena.freeSpace());
+        Check(rest != ArenaAllocator::InvalidHandle && arena.offset(rest) == packedEnd,
+            "whole remaining space allocatable");
+    }
+
+    void CheckGrow() {
+        std::printf("grow\n");
+        ArenaAllocator arena(50);
+        const Handle a = arena.allocate(30);
+        const Handle b = arena.allocate(20);
+        Check(arena.allocate(10) == ArenaAllocator::InvalidHandle, "full arena refuses");
+        arena.grow(80);
+        const Handle c = arena.allocate(30);
+        Check(arena.capacity() == 80 && c != ArenaAllocator::InvalidHandle && arena.offset(c) == 50,
+            "after grow the allocation lands in the new space");
+        Check(arena.offset(a) == 0 && arena.offset(b) == 30, "existing allocations keep their offsets");
+        arena.grow(60);
+        Check(arena.capacity() == 80, "grow to a smaller capacity is ignored");
+
+        // Freier Block am Ende waechst mit: ein Block statt zwei
+        ArenaAllocator tail(50);
+        tail.allocate(40);
+        tail.grow(100);
+        Check(tail.stats().freeBlocks == 1 && tail.stats().largestFree == 60, "trailing hole extended by grow");
+        const Handle d = tail.allocate(60);
+        Check(d != ArenaAllocator::InvalidHandle && tail.offset(d) == 40, "extended hole allocatable in one piece");
+
+        ArenaAllocator empty;
+        Check(empty.allocate(1) == ArenaAllocator::InvalidHandle, "zero-capacity arena refuses");
+        empty.grow(16);
+        Check(empty.allocate(16) != ArenaAllocator::InvalidHandle, "and accepts after the first grow");
+    }
+
+    // Referenz: Besitzer jeder Einheit (0 = frei), Loecher per linearem Scan
+    struct Reference {
+        std::vector<int> owner;
+
+        // Best Fit: kleinstes passendes Loch, bei Gleichstand niedrigster Offset; -1 = keins
+        long BestFit(std::size_t size, std::size_t& holes, std::size_t& largest) const {
+            long best = -1;
+            std::size_t bestSize = 0;
+            holes = largest = 0;
+            for (std::size_t i = 0; i < owner.size();) {
+                if (owner[i]) { ++i; continue; }
+                std::size_t j = i;
+                while (j < owner.size() && !owner[j]) ++j;
+                const std::size_t hole = j - i;
+                ++holes;
+                largest = std::max(largest, hole);
+                if (hole >= size && (best < 0 || hole < bestSize)) {
+                    best = long(i);
+                    bestSize = hole;
+                }
+                i = j;
+            }
+            return best;
+        }
+    };
+
+    void CheckRandom() {
+        std::printf("random run against a unit-by-unit reference\n");
+        ArenaAllocator arena(256);
+        Reference ref{ std::vector<int>(256, 0) };
+        std::vector<Handle> live;
+        std::mt19937 rng(11);
+        std::size_t bad = 0, allocs = 0, fails = 0;
+
+        for (int it = 0; it < 50000; ++it) {
+            const int op = int(rng() % 100);
+            if (op < 55) {
+                const std::size_t size = 1 + rng() % 24;
+                std::size_t holes, largest;
+                const long want = ref.BestFit(size, holes, largest);
+                const Handle h = arena.allocate(size);
+                if ((h == ArenaAllocator::InvalidHandle) != (want < 0)) { ++bad; continue; }
+                if (h == ArenaAllocator::InvalidHandle) { ++fails; continue; }
+                ++allocs;
+                if (arena.offset(h) != std::size_t(want) || arena.size(h) != size) ++bad;
+                for (std::size_t i = 0; i < size; ++i) {
+                    if (ref.owner[arena.offset(h) + i]) ++bad;
+                    ref.owner[arena.offset(h) + i] = int(h) + 1;
+                }
+                live.push_back(h);
+            }
+            else if (op < 95) {
+                if (live.empty()) continue;
+                const std::size_t i = rng() % live.size();
+                const Handle h = live[i];
+                for (std::size_t u = 0; u < arena.size(h); ++u) {
+                    if (ref.owner[arena.offset(h) + u] != int(h) + 1) ++bad;
+                    ref.owner[arena.offset(h) + u] = 0;
+                }
+                arena.release(h);
+                live[i] = live.back();
+                live.pop_back();
+            }
+            else if (op < 98) {
+                std::vector<int> fresh(ref.owner.size(), 0);
+                arena.compact([&](Handle h, std::size_t from, std::size_t to, std::size_t size) {
+                    for (std::size_t u = 0; u < size; ++u) {
+                        if (ref.owner[from + u] != int(h) + 1) ++bad;
+                        fresh[to + u] = ref.owner[from + u];
+                    }
+                });
+                ref.owner.swap(fresh);
+            }
+            else if (arena.capacity() < 1024) {
+                const std::size_t capacity = arena.capacity() + 1 + rng() % 64;
+                arena.grow(capacity);
+                ref.owner.resize(capacity, 0);
+            }
+
+            std::size_t holes, largest, used = 0;
+            ref.BestFit(~std::size_t(0), holes, largest);
+            for (int o : ref.owner) used += o ? 1 : 0;
+            const ArenaAllocator::Stats& s = arena.stats();
+            if (s.used != used || s.allocations != live.size() || s.freeBlocks != holes || s.largestFree != largest ||
+                s.capacity != ref.owner.size())
+                ++bad;
+        }
+        std::printf("  %zu allocations, %zu refused, final capacity %zu\n", allocs, fails, arena.capacity());
+        Check(fails > 0 && allocs > 0, "run exercised both fits and refusals");
+        Check(bad == 0, "50k allocate/release/compact/grow operations match");
+    }
+
+} // namespace
+
+int main() {
+    CheckBestFit();
+    CheckCoalescing();
+    CheckCompact();
+    CheckGrow();
+    CheckRandom();
+    std::printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,213 @@
+// Geometry-Arena-Benchmark: Chunk-Meshes im gemeinsamen Vertex-Buffer (ArenaAllocator) bei
+// Streaming-Flug mit Sichtweite 24 + LOD ab 6 (wie der Client), dazu Remeshes durch Edits.
+// Mesh-Groessen stammen aus echten Greedy-/LOD-Meshes des Noise-Terrains.
+// Ausgabe: Belegung, Fragmentierung, Kompaktierungen/Vergroesserungen, kopierte Vertices und
+// ns pro allocate/release. Die Wachstumsregel entspricht GeometryArena im Client.
+#include <BrickWorlds/Core/ArenaAllocator.h>
+#include <BrickWorlds/Voxel/ChunkMesher.h>
+
+#include "BenchTerrain.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace BrickWorlds::Voxel;
+using BrickWorlds::Core::ArenaAllocator;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int ViewDistance = 24;
+    constexpr int LodStart = 6;
+    constexpr int FlightChunks = 200;
+    constexpr int RemeshesPerStep = 20;
+    constexpr std::size_t InitialVertices = std::size_t(1) << 20;   // wie Renderer::kInitialArenaVertices
+
+    // Vertex-Zahlen je LOD aus 5x5 gemeshten Noise-Chunks
+    std::vector<std::size_t> MeshSizes(int lod) {
+        BrickWorlds::Bench::NoiseGenerator gen;
+        constexpr int Size = 7;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        for (int cz = 0; cz < Size; ++cz)
+            for (int cx = 0; cx < Size; ++cx) {
+                auto ch = std::make_unique<Chunk>(ChunkKey{ cx, cz });
+                gen.Generate(*ch);
+                ch->BlocksUnsafe().Compact();
+                ch->BlocksUnsafe().RecomputeHeights();
+                ch->PublishUnsafe();
+                chunks.push_back(std::move(ch));
+            }
+        auto at = [&](int cx, int cz) -> const Chunk& { return *chunks[static_cast<std::size_t>(cz * Size + cx)]; };
+
+        const ChunkMesher mesher(MeshMode::Greedy);
+        ChunkMeshData data;
+        std::vector<std::size_t> sizes;
+        for (int cz = 1; cz < Size - 1; ++cz)
+            for (int cx = 1; cx < Size - 1; ++cx) {
+                const MeshNeighborhood n{ ChunkKey{ cx, cz }, at(cx, cz).View(), at(cx - 1, cz).View(),
+                    at(cx + 1, cz).View(), at(cx, cz - 1).View(), at(cx, cz + 1).View() };
+                mesher.BuildLod(n, lod, data);
+                sizes.push_back(data.VertexCount());
+            }
+        return sizes;
+    }
+
+    int LodFor(int d) {
+        int lod = 0;
+        for (int limit = LodStart; d > limit && lod < MaxLod; limit *= 2) ++lod;
+        return lod;
+    }
+
+    struct Mesh {
+        ArenaAllocator::Handle handle = ArenaAllocator::InvalidHandle;
+        int lod = 0;
+    };
+
+    struct Sim {
+        explicit Sim(std::size_t initialVertices) : arena(initialVertices) {}
+
+        ArenaAllocator arena;
+        std::vector<std::size_t> sizes[MaxLod + 1];
+        std::unordered_map<ChunkKey, Mesh, ChunkKeyHash> meshes;
+        std::mt19937 rng{ 11 };
+
+        std::size_t allocations = 0;
+        std::size_t releases = 0;
+        double allocNs = 0.0;
+        double releaseNs = 0.0;
+        std::size_t grows = 0;
+        std::size_t relocatedVertices = 0;
+        double maxFragmentation = 0.0;
+
+        std::size_t SizeFor(const ChunkKey& k, int lod, bool jitter) {
+            const auto& pool = sizes[lod];
+            std::size_t s = pool[ChunkKeyHash{}(k) % pool.size()];
+            // Edit: Mesh waechst/schrumpft um bis zu 15%
+            if (jitter) s = s * (85 + rng() % 31) / 100;
+            return std::max<std::size_t>(s, 4);
+        }
+
+        // Wie GeometryArena::upload: kompaktieren, wenn genug Platz frei ist, sonst verdoppeln
+        ArenaAllocator::Handle Allocate(std::size_t count) {
+            const auto t0 = Clock::now();
+            ArenaAllocator::Handle h = arena.allocate(count);
+            if (h == ArenaAllocator::InvalidHandle) {
+                std::size_t capacity = arena.capacity();
+                if (arena.freeSpace() < count + capacity / 4) {
+                    capacity = std::max<std::size_t>(capacity * 2, 1024);
+                    while (capacity - arena.stats().used < count + capacity / 4) capacity *= 2;
+                    ++grows;
+                }
+                relocatedVertices += arena.stats().used;   // Kopie in den neuen Buffer
+                arena.compact([](ArenaAllocator::Handle, std::size_t, std::size_t, std::size_t) {});
+                arena.grow(capacity);
+                h = arena.allocate(count);
+            }
+            allocNs += std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+            ++allocations;
+            return h;
+        }
+
+        void Release(ArenaAllocator::Handle h) {
+            const auto t0 = Clock::now();
+            arena.release(h);
+            releaseNs += std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+            ++releases;
+        }
+
+        void Upload(const ChunkKey& k, int lod, bool jitter) {
+            Mesh& m = meshes[k];
+            if (m.handle != ArenaAllocator::InvalidHandle) Release(m.handle);
+            m.lod = lod;
+            m.handle = Allocate(SizeFor(k, lod, jitter));
+        }
+
+        void Unload(const ChunkKey& k) {
+            auto it = meshes.find(k);
+            if (it == meshes.end()) return;
+            Release(it->second.handle);
+            meshes.erase(it);
+        }
+
+        void Sample() { maxFragmentation = std::max(maxFragmentation, arena.stats().fragmentation()); }
+    };
+
+    void Print(const char* label, const Sim& sim) {
+        const auto& s = sim.arena.stats();
+        const double mb = 8.0 / (1024.0 * 1024.0);
+        std::printf("  %-14s %8zu %8.1f %8.1f %6.1f%% %7zu %8.1f %6.3f %6.3f %6zu %6zu %9.1f\n", label, s.allocations,
+            s.used * mb, s.capacity * mb, 100.0 * double(s.used) / double(s.capacity), s.freeBlocks,
+            s.largestFree * mb, s.fragmentation(), sim.maxFragmentation, s.compactions, sim.grows,
+            sim.relocatedVertices * mb);
+    }
+
+    void Run(const char* name, std::size_t initialVertices, const std::vector<std::size_t>* sizes) {
+        Sim sim(initialVertices);
+        for (int lod = 0; lod <= MaxLod; ++lod) sim.sizes[lod] = sizes[lod];
+
+        std::printf("%s: start %.1f MB\n", name, initialVertices * 8.0 / (1024.0 * 1024.0));
+        std::printf("  %-14s %8s %8s %8s %7s %7s %8s %6s %6s %6s %6s %9s\n", "phase", "meshes", "used MB", "cap MB",
+            "util", "blocks", "maxfree", "frag", "max", "compct", "grows", "copied MB");
+
+        // Start: alle Chunks im Sichtquadrat, naechste zuerst (wie die Upload-Queue)
+        std::vector<ChunkKey> initial;
+        for (int dz = -ViewDistance; dz <= ViewDistance; ++dz)
+            for (int dx = -ViewDistance; dx <= ViewDistance; ++dx) initial.push_back({ dx, dz });
+        std::sort(initial.begin(), initial.end(), [](const ChunkKey& a, const ChunkKey& b) {
+            return std::max(std::abs(a.cx), std::abs(a.cz)) < std::max(std::abs(b.cx), std::abs(b.cz));
+        });
+        for (const ChunkKey& k : initial) sim.Upload(k, LodFor(std::max(std::abs(k.cx), std::abs(k.cz))), false);
+        sim.Sample();
+        Print("initial load", sim);
+
+        // Flug in +X: Spalte hinten entladen, vorne laden, LOD-Wechsel neu hochladen, Edits nahe der Kamera
+        for (int step = 1; step <= FlightChunks; ++step) {
+            const int cx = step;
+            for (int dz = -ViewDistance; dz <= ViewDistance; ++dz) {
+                sim.Unload({ cx - ViewDistance - 1, dz });
+                sim.Upload({ cx + ViewDistance, dz }, LodFor(std::max(ViewDistance, std::abs(dz))), false);
+            }
+            for (auto& kv : sim.meshes) {
+                const int lod = LodFor(std::max(std::abs(kv.first.cx - cx), std::abs(kv.first.cz)));
+                if (lod != kv.second.lod) {
+                    sim.Release(kv.second.handle);
+                    kv.second.lod = lod;
+                    kv.second.handle = sim.Allocate(sim.SizeFor(kv.first, lod, false));
+                }
+            }
+            for (int e = 0; e < RemeshesPerStep; ++e) {
+                const ChunkKey k{ cx + static_cast<int>(sim.rng() % 9) - 4, static_cast<int>(sim.rng() % 9) - 4 };
+                sim.Upload(k, 0, true);
+            }
+            sim.Sample();
+            if (step % 50 == 0) {
+                char label[32];
+                std::snprintf(label, sizeof(label), "flight %d", step);
+                Print(label, sim);
+            }
+        }
+
+        std::printf("  allocate %.0f ns, release %.0f ns (avg over %zu / %zu, incl. relocation)\n",
+            sim.allocNs / double(sim.allocations), sim.releaseNs / double(sim.releases), sim.allocations, sim.releases);
+    }
+
+} // namespace
+
+int main() {
+    std::vector<std::size_t> sizes[MaxLod + 1];
+    for (int lod = 0; lod <= MaxLod; ++lod) sizes[lod] = MeshSizes(lod);
+
+    std::printf("geometry arena: view %d, LOD from %d, flight %d chunks, %d remeshes per step\n",
+        ViewDistance, LodStart, FlightChunks, RemeshesPerStep);
+    Run("client default", InitialVertices, sizes);
+    // Klein gestartet: Wachstum und Kompaktierung unter Last
+    Run("small start", InitialVertices / 16, sizes);
+    return 0;
+}
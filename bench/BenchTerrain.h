@@ -0,0 +1,114 @@
+#pragma once
+#include <cmath>
+#include <cstdint>
+
+#include <BrickWorlds/Voxel/BlockId.h>
+#include <BrickWorlds/Voxel/World.h>
+
+namespace BrickWorlds::Bench {
+
+    using namespace BrickWorlds::Voxel;
+
+    // Deterministischer Hash fuer Gitterpunkte (Value-Noise)
+    inline std::uint32_t HashCoords(std::int32_t x, std::int32_t y, std::int32_t z, std::uint32_t seed) {
+        std::uint32_t h = seed;
+        h ^= static_cast<std::uint32_t>(x) * 0x8da6b343u;
+        h ^= static_cast<std::uint32_t>(y) * 0xd8163841u;
+        h ^= static_cast<std::uint32_t>(z) * 0xcb1ab31fu;
+        h ^= h >> 15;
+        h *= 0x2c1b3c6du;
+        h ^= h >> 12;
+        h *= 0x297a2d39u;
+        h ^= h >> 15;
+        return h;
+    }
+
+    inline float ValueNoise2D(float x, float z, std::uint32_t seed) {
+        const int x0 = static_cast<int>(std::floor(x));
+        const int z0 = static_cast<int>(std::floor(z));
+        const float fx = x - static_cast<float>(x0);
+        const float fz = z - static_cast<float>(z0);
+
+        auto corner = [&](int cx, int cz) {
+            return static_cast<float>(HashCoords(cx, 0, cz, seed) & 0xffffu) / 65535.0f;
+        };
+        auto smooth = [](float t) { return t * t * (3.0f - 2.0f * t); };
+
+        const float sx = smooth(fx);
+        const float sz = smooth(fz);
+        const float a = corner(x0, z0) + (corner(x0 + 1, z0) - corner(x0, z0)) * sx;
+        const float b = corner(x0, z0 + 1) + (corner(x0 + 1, z0 + 1) - corner(x0, z0 + 1)) * sx;
+        return a + (b - a) * sz;
+    }
+
+    // "Verrauschtes" Terrain fuer Benchmarks: Hoehenkarte aus zwei Oktaven
+    // Value-Noise, Wasser bis Meereshoehe und verstreute Erz-Ids im Fels.
+    class NoiseGenerator final : public IChunkGenerator {
+    public:
+        explicit NoiseGenerator(std::uint32_t seed = 1337, int oreKinds = 6)
+            : seed_(seed), oreKinds_(oreKinds) {
+        }
+
+        void Generate(Chunk& chunk) override {
+            auto& b = chunk.BlocksUnsafe();
+            const auto key = chunk.Key();
+
+            for (int z = 0; z < ChunkZ; ++z) {
+                for (int x = 0; x < ChunkX; ++x) {
+                    const int wx = key.cx * ChunkX + x;
+                    const int wz = key.cz * ChunkZ + z;
+                    const float n = ValueNoise2D(wx / 48.0f, wz / 48.0f, seed_) * 0.75f
+                        + ValueNoise2D(wx / 12.0f, wz / 12.0f, seed_ + 1) * 0.25f;
+                    const int height = 40 + static_cast<int>(n * 48.0f);
+
+                    for (int y = 0; y < ChunkY; ++y) {
+                        BlockId id = Air;
+                        if (y < height - 3) {
+                            id = Rock;
+                            const std::uint32_t h = HashCoords(wx, y, wz, seed_ + 2);
+                            if (oreKinds_ > 0 && (h & 31u) == 0) id = static_cast<BlockId>(Water + 1 + (h >> 8) % oreKinds_);
+                        }
+                        else if (y < height) id = Dirt;
+                        else if (y < SeaLevel) id = Water;
+                        b.Set(Index(x, y, z), id);
+                    }
+                }
+            }
+        }
+
+        static constexpr int SeaLevel = 62;
+
+    private:
+        std::uint32_t seed_;
+        int oreKinds_;
+    };
+
+    // Worst Case fuer den Mesher: jeder Block bis maxHeight zufaellig (fill = Anteil solide,
+    // gemischte Ids), kaum zusammenhaengende Flaechen und viele Seiten zu Luft
+    class RandomGenerator final : public IChunkGenerator {
+    public:
+        explicit RandomGenerator(std::uint32_t seed = 4711, float fill = 0.5f, int maxHeight = 64)
+            : seed_(seed), fill_(fill), maxHeight_(maxHeight) {
+        }
+
+        void Generate(Chunk& chunk) override {
+            auto& b = chunk.BlocksUnsafe();
+            const auto key = chunk.Key();
+            const std::uint32_t threshold = static_cast<std::uint32_t>(fill_ * 65535.0f);
+
+            for (int y = 0; y < maxHeight_; ++y)
+                for (int z = 0; z < ChunkZ; ++z)
+                    for (int x = 0; x < ChunkX; ++x) {
+                        const std::uint32_t h = HashCoords(key.cx * ChunkX + x, y, key.cz * ChunkZ + z, seed_);
+                        if ((h & 0xffffu) >= threshold) continue;
+                        b.Set(Index(x, y, z), static_cast<BlockId>(Dirt + (h >> 16) % 3));
+                    }
+        }
+
+    private:
+        std::uint32_t seed_;
+        float fill_;
+        int maxHeight_;
+    };
+
+} // namespace BrickWorlds::Bench
@@ -0,0 +1,182 @@
+// Cave-Culling-Pruefung: Verbindungsgraphen (SectionConnectivity) und BFS (SectionOcclusion)
+// auf synthetischen Layouts - versiegelte Hoehlen, L-foermiger Tunnel, offene Oberflaeche.
+// Prueft die 15-Bit-Masken und die von der Kamera-Section erreichten Sections,
+// misst danach einen BFS ueber das Client-Raster (Sichtweite 24). Exit-Code 1 bei Abweichung.
+#include <BrickWorlds/Voxel/FaceMask.h>
+#include <BrickWorlds/Voxel/PaddedChunk.h>
+#include <BrickWorlds/Voxel/SectionVisibility.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int SurfaceY = 40;          // offene Oberflaeche: massiv bis y 39
+    constexpr int ViewDistance = 24;      // wie der Client
+    constexpr int Iterations = 50;
+
+    int failures = 0;
+
+    void Check(bool ok, const char* what, unsigned got, unsigned want) {
+        std::printf("  %-44s %s (got 0x%04x, want 0x%04x)\n", what, ok ? "ok  " : "FAIL", got, want);
+        if (!ok) ++failures;
+    }
+
+    std::uint16_t Pair(int a, int b) { return static_cast<std::uint16_t>(1u << FacePairBit(a, b)); }
+
+    // Alles massiv (auch der Rand aus den Nachbarn)
+    std::unique_ptr<ChunkOccupancy> Solid() {
+        auto occ = std::make_unique<ChunkOccupancy>();
+        for (ColumnMask& c : occ->cols)
+            for (std::uint64_t& w : c.w) w = ~std::uint64_t{ 0 };
+        return occ;
+    }
+
+    void Carve(ChunkOccupancy& occ, int lx, int y, int lz) {
+        occ.At(lx, lz).w[y >> 6] &= ~(std::uint64_t{ 1 } << (y & 63));
+    }
+
+    void CarveBox(ChunkOccupancy& occ, int x0, int y0, int z0, int x1, int y1, int z1) {
+        for (int z = z0; z <= z1; ++z)
+            for (int y = y0; y <= y1; ++y)
+                for (int x = x0; x <= x1; ++x) Carve(occ, x, y, z);
+    }
+
+    // Von den Flood-Fills berechnete Masken, Eingabe fuer den BFS-Teil
+    struct Masks {
+        std::uint16_t tunnel = 0;
+        std::uint16_t surface = 0;
+    };
+
+    Masks CheckMasks() {
+        std::printf("section connectivity\n");
+
+        // Versiegelte Hoehle mitten in der Section; zweite Hoehle beruehrt nur -Y
+        auto pocket = Solid();
+        const int py = SectionY;
+        CarveBox(*pocket, 6, py + 6, 6, 9, py + 9, 9);
+        CarveBox(*pocket, 2, py, 2, 3, py + 2, 3);
+        const std::uint16_t sealed = SectionConnectivity(*pocket, 1);
+        Check(sealed == 0, "sealed pocket", sealed, 0);
+
+        // L-Tunnel in Section 3: von -X bis zur Mitte, dann nach +Z
+        auto tunnel = Solid();
+        const int ty = 3 * SectionY + 5;
+        CarveBox(*tunnel, 0, ty, 8, 8, ty, 8);
+        CarveBox(*tunnel, 8, ty, 8, 8, ty, ChunkZ - 1);
+        const std::uint16_t l = SectionConnectivity(*tunnel, 3);
+        Check(l == Pair(FaceMinusX, FacePlusZ), "L tunnel (-X <-> +Z)", l, Pair(FaceMinusX, FacePlusZ));
+
+        // Offene Oberflaeche: massiv darunter, Uebergangs-Section ohne -Y, Luft darueber voll verbunden.
+        // Eine Blase im Gestein der Uebergangs-Section darf daran nichts aendern.
+        auto surface = Solid();
+        CarveBox(*surface, 0, SurfaceY, 0, ChunkX - 1, ChunkY - 1, ChunkZ - 1);
+        CarveBox(*surface, 6, SurfaceY - 7, 6, 9, SurfaceY - 5, 9);
+        std::uint16_t boundary = 0;
+        for (int a : { FacePlusZ, FaceMinusZ, FacePlusY, FacePlusX, FaceMinusX })
+            for (int b : { FacePlusZ, FaceMinusZ, FacePlusY, FacePlusX, FaceMinusX })
+                if (a < b) boundary |= Pair(a, b);
+        const int surfaceSy = SurfaceY / SectionY;
+        const std::uint16_t below = SectionConnectivity(*surface, surfaceSy - 1);
+        const std::uint16_t at = SectionConnectivity(*surface, surfaceSy);
+        const std::uint16_t above = SectionConnectivity(*surface, surfaceSy + 1);
+        Check(below == 0, "surface: solid section below", below, 0);
+        Check(at == boundary, "surface: boundary section (no -Y)", at, boundary);
+        Check(above == AllFacesConnected, "surface: air section above", above, AllFacesConnected);
+        return Masks{ l, at };
+    }
+
+    // Raster mit radius um (0, 0), alle Chunks mit denselben Masken
+    void Fill(SectionOcclusion& occ, int radius, const std::uint16_t* connectivity) {
+        occ.Begin(ChunkKey{ 0, 0 }, radius);
+        for (int cz = -radius; cz <= radius; ++cz)
+            for (int cx = -radius; cx <= radius; ++cx) occ.SetChunk(ChunkKey{ cx, cz }, connectivity, true);
+    }
+
+    void CheckTraversal(const Masks& masks) {
+        std::printf("section BFS\n");
+        SectionOcclusion occ;
+
+        // Versiegelte Hoehle unter der Oberflaeche: alle Sections unter der Uebergangs-Section sind
+        // Luft und untereinander voll verbunden, ebenso alles darueber. Nur die berechnete Maske
+        // der Uebergangs-Section (kein Paar mit -Y) trennt die Hoehle von der Kamera in der Luft.
+        std::uint16_t layout[SectionCount];
+        const int surfaceSy = SurfaceY / SectionY;
+        for (int sy = 0; sy < SectionCount; ++sy) layout[sy] = AllFacesConnected;
+        layout[surfaceSy] = masks.surface;
+        Fill(occ, 2, layout);
+        occ.Traverse(10);
+        const std::uint32_t openWant = AllSections & ~((1u << surfaceSy) - 1);
+        const std::uint32_t caveBits = (1u << surfaceSy) - 1;
+        std::uint32_t open = openWant, cave = 0;
+        for (int cz = -2; cz <= 2; ++cz)
+            for (int cx = -2; cx <= 2; ++cx) {
+                const std::uint32_t got = occ.VisibleSections(ChunkKey{ cx, cz });
+                if ((got & ~caveBits) != openWant) open = got & ~caveBits;
+                cave |= got & caveBits;
+            }
+        Check(open == openWant, "sealed cave: surface and air above visible", open, openWant);
+        Check(cave == 0, "sealed cave: cave sections below culled", cave, 0);
+
+        // Gegenprobe: ein Loch im Boden von (0, 1) oeffnet die Hoehle, sie muss sichtbar werden
+        std::uint16_t holed[SectionCount];
+        std::copy(std::begin(layout), std::end(layout), holed);
+        holed[surfaceSy] = AllFacesConnected;
+        Fill(occ, 2, layout);
+        occ.SetChunk(ChunkKey{ 0, 1 }, holed, true);
+        occ.Traverse(10);
+        const std::uint32_t below = occ.VisibleSections(ChunkKey{ 0, 1 }) & caveBits;
+        Check(below == caveBits, "open cave: sections under a hole visible", below, caveBits);
+
+        // L-Tunnel: Kamera in (-1, 0) Section 3, alles andere massiv. Der Tunnel im Center-Chunk
+        // fuehrt von -X nach +Z: (0, 1) wird erreicht, (1, 0) und (0, -1) nicht
+        std::uint16_t solid[SectionCount] = {};
+        std::uint16_t tunnel[SectionCount] = {};
+        tunnel[3] = masks.tunnel;
+        occ.Begin(ChunkKey{ -1, 0 }, 2);
+        for (int cz = -2; cz <= 2; ++cz)
+            for (int cx = -3; cx <= 1; ++cx)
+                occ.SetChunk(ChunkKey{ cx, cz }, (cx == 0 && cz == 0) ? tunnel : solid, true);
+        occ.Traverse(3);
+        const std::uint32_t camera = occ.VisibleSections(ChunkKey{ -1, 0 });
+        const std::uint32_t centre = occ.VisibleSections(ChunkKey{ 0, 0 });
+        const std::uint32_t exitZ = occ.VisibleSections(ChunkKey{ 0, 1 });
+        const std::uint32_t pastX = occ.VisibleSections(ChunkKey{ 1, 0 });
+        const std::uint32_t wrongZ = occ.VisibleSections(ChunkKey{ 0, -1 });
+        Check(camera == 0x1c, "L tunnel: camera chunk sections 2-4", camera, 0x1c);
+        Check(centre == 0x08, "L tunnel: tunnel section entered", centre, 0x08);
+        Check(exitZ == 0x08, "L tunnel: +Z exit reached", exitZ, 0x08);
+        Check(pastX == 0, "L tunnel: +X behind the bend culled", pastX, 0);
+        Check(wrongZ == 0, "L tunnel: -Z side culled", wrongZ, 0);
+    }
+
+    void MeasureTraversal() {
+        std::uint16_t surface[SectionCount];
+        for (int sy = 0; sy < SectionCount; ++sy) surface[sy] = sy < SurfaceY / SectionY ? 0 : AllFacesConnected;
+
+        SectionOcclusion occ;
+        double best = 1e30;
+        for (int i = 0; i < Iterations; ++i) {
+            const auto t0 = Clock::now();
+            Fill(occ, ViewDistance, surface);
+            occ.Traverse(10);
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        }
+        std::printf("open surface, view %d: %zu sections visited, best %.3f ms per BFS (of %d)\n",
+            ViewDistance, occ.VisitedSectionCount(), best, Iterations);
+    }
+
+} // namespace
+
+int main() {
+    CheckTraversal(CheckMasks());
+    MeasureTraversal();
+    std::printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
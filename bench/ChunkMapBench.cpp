@@ -0,0 +1,118 @@
+// Contention-Benchmark der Chunk-Map: unordered_map + ein shared_mutex (alt)
+// vs. geshardete Open-Addressing-Map (ChunkMap) bei 1/4/16 Threads.
+// Mix pro Thread: 90% Lookups (wie GetBlock/Nachbar-Suche), 10% Erase+Insert (Streaming).
+#include <BrickWorlds/Voxel/ChunkMap.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    // Bisherige Implementierung aus ChunkManager
+    class LegacyMap {
+    public:
+        std::shared_ptr<Chunk> Find(const ChunkKey& key) const {
+            std::shared_lock lk(mtx_);
+            auto it = map_.find(key);
+            return (it != map_.end()) ? it->second : nullptr;
+        }
+        std::shared_ptr<Chunk> Insert(const ChunkKey& key, std::shared_ptr<Chunk> value) {
+            std::unique_lock lk(mtx_);
+            auto& ref = map_[key];
+            if (!ref) ref = std::move(value);
+            return ref;
+        }
+        std::shared_ptr<Chunk> Erase(const ChunkKey& key) {
+            std::unique_lock lk(mtx_);
+            auto it = map_.find(key);
+            if (it == map_.end()) return nullptr;
+            auto removed = std::move(it->second);
+            map_.erase(it);
+            return removed;
+        }
+
+    private:
+        mutable std::shared_mutex mtx_;
+        std::unordered_map<ChunkKey, std::shared_ptr<Chunk>, ChunkKeyHash> map_;
+    };
+
+    constexpr int Radius = 12;                 // 25x25 geladene Chunks
+    constexpr int OpsPerThread = 400000;
+
+    std::uint32_t NextRandom(std::uint32_t& s) {
+        s ^= s << 13;
+        s ^= s >> 17;
+        s ^= s << 5;
+        return s;
+    }
+
+    template <typename Map>
+    double Run(int threads) {
+        Map map;
+        std::vector<std::shared_ptr<Chunk>> chunks;
+        for (int cz = -Radius; cz <= Radius; ++cz)
+            for (int cx = -Radius; cx <= Radius; ++cx) {
+                chunks.push_back(std::make_shared<Chunk>(ChunkKey{ cx, cz }));
+                map.Insert({ cx, cz }, chunks.back());
+            }
+
+        std::atomic<int> ready{ 0 };
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> workers;
+        std::atomic<std::uint64_t> found{ 0 };
+
+        for (int t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::uint32_t rng = 0x9e3779b9u * static_cast<std::uint32_t>(t + 1);
+                std::uint64_t hits = 0;
+                ready.fetch_add(1);
+                while (!go.load(std::memory_order_acquire)) {}
+
+                for (int i = 0; i < OpsPerThread; ++i) {
+                    const std::uint32_t r = NextRandom(rng);
+                    const ChunkKey key{ static_cast<int>(r % (2 * Radius + 1)) - Radius,
+                                        static_cast<int>((r >> 8) % (2 * Radius + 1)) - Radius };
+                    if ((r >> 24) % 10 == 0) {
+                        auto removed = map.Erase(key);
+                        if (removed) map.Insert(key, std::move(removed));
+                    }
+                    else if (map.Find(key)) {
+                        ++hits;
+                    }
+                }
+                found.fetch_add(hits);
+                });
+        }
+
+        while (ready.load() != threads) {}
+        const auto t0 = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        for (auto& w : workers) w.join();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const double secs = std::chrono::duration<double>(t1 - t0).count();
+        return static_cast<double>(threads) * OpsPerThread / secs / 1e6;
+    }
+
+} // namespace
+
+int main() {
+    std::printf("chunk map contention (25x25 chunks, 90%% lookup / 10%% erase+insert)\n");
+    std::printf("  threads   legacy Mops/s   sharded Mops/s   speedup\n");
+    for (int threads : { 1, 4, 16 }) {
+        const double legacy = Run<LegacyMap>(threads);
+        const double sharded = Run<ChunkMap>(threads);
+        std::printf("  %7d   %13.2f   %14.2f   %6.2fx\n", threads, legacy, sharded, sharded / legacy);
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+// Speicherbericht: Bytes pro Chunk (flaches Array vs. Palette-Speicher)
+// fuer FlatGenerator- und Noise-Terrain.
+#include <BrickWorlds/Voxel/Chunk.h>
+#include <BrickWorlds/Voxel/FlatGenerator.h>
+
+#include "BenchTerrain.h"
+
+#include <cstdio>
+#include <map>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    void Report(const char* name, IChunkGenerator& gen, int radius) {
+        const std::size_t legacyBytes = sizeof(BlockId) * static_cast<std::size_t>(ChunkVolume);
+
+        std::size_t chunks = 0;
+        std::size_t storageBytes = 0;
+        std::size_t chunkBytes = 0;
+        std::map<int, int> bitsHistogram;
+
+        for (int cz = -radius; cz <= radius; ++cz) {
+            for (int cx = -radius; cx <= radius; ++cx) {
+                Chunk ch(ChunkKey{ cx, cz });
+                gen.Generate(ch);
+                ch.BlocksUnsafe().Compact();
+
+                ++chunks;
+                storageBytes += ch.BlocksUnsafe().MemoryUsage();
+                chunkBytes += ch.MemoryUsage();
+                for (int sy = 0; sy < SectionCount; ++sy) {
+                    const BlockStorage* sec = ch.BlocksUnsafe().SectionStorage(sy);
+                    ++bitsHistogram[sec ? sec->BitsPerBlock() : 0];
+                }
+            }
+        }
+
+        const double avgStorage = static_cast<double>(storageBytes) / static_cast<double>(chunks);
+        const double avgChunk = static_cast<double>(chunkBytes) / static_cast<double>(chunks);
+
+        std::printf("%-6s chunks=%zu\n", name, chunks);
+        std::printf("  before (flat BlockId array): %10zu bytes/chunk\n", legacyBytes);
+        std::printf("  after  (palette storage):    %10.0f bytes/chunk  (%.1fx smaller)\n",
+            avgStorage, static_cast<double>(legacyBytes) / avgStorage);
+        std::printf("  after  (whole Chunk object): %10.0f bytes/chunk\n", avgChunk);
+        std::printf("  sections:");
+        for (auto& kv : bitsHistogram) {
+            if (kv.first == 0) std::printf(" uniform x%d", kv.second);
+            else std::printf(" %d bit x%d", kv.first, kv.second);
+        }
+        std::printf("\n");
+    }
+
+} // namespace
+
+int main() {
+    const int radius = 6; // 13x13 Chunks = Sichtweite eines Spielers
+
+    FlatGenerator flat;
+    BrickWorlds::Bench::NoiseGenerator noise;
+
+    Report("flat", flat, radius);
+    Report("noise", noise, radius);
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Upload-Queue-Pruefung (DirtyChunkQueue): Entnahme nach Chebyshev-Ring, Neu-Einsortierung
+// beim Center-Wechsel, keine doppelten Keys, Remove. Danach ein Zufallslauf gegen eine
+// naive Referenz (linearer Scan nach dem kleinsten Abstand). Exit-Code 1 bei Abweichung.
+#include <BrickWorlds/Voxel/DirtyChunkQueue.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    int failures = 0;
+
+    void Check(bool ok, const char* what) {
+        std::printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) ++failures;
+    }
+
+    int Ring(const ChunkKey& k, const ChunkKey& c) { return std::max(std::abs(k.cx - c.cx), std::abs(k.cz - c.cz)); }
+
+    // Ringe der entnommenen Keys in Reihenfolge
+    std::vector<int> DrainRings(DirtyChunkQueue& q) {
+        std::vector<int> rings;
+        ChunkKey k;
+        while (q.TryPop(k)) rings.push_back(Ring(k, q.Center()));
+        return rings;
+    }
+
+    void CheckOrder() {
+        std::printf("ordering\n");
+        DirtyChunkQueue q;
+        q.SetCenter({ 0, 0 });
+        // Absichtlich von aussen nach innen eingereiht
+        for (int d = 5; d >= 0; --d) {
+            q.Push({ d, 0 });
+            q.Push({ -d, d });
+        }
+        const std::vector<int> rings = DrainRings(q);
+        Check(rings.size() == 11, "all keys drained (ring 0 only once)");
+        Check(std::is_sorted(rings.begin(), rings.end()), "drained nearest ring first");
+
+        // Center springt: dieselben Keys nach Abstand zum neuen Center
+        for (int x = -6; x <= 6; ++x) q.Push({ x, 0 });
+        q.SetCenter({ 6, 0 });
+        ChunkKey first;
+        q.TryPop(first);
+        Check(first.cx == 6 && first.cz == 0, "after moving the center its own chunk comes first");
+        const std::vector<int> moved = DrainRings(q);
+        Check(std::is_sorted(moved.begin(), moved.end()) && moved.size() == 12 && moved.back() == 12,
+            "remaining keys re-sorted around the new center");
+
+        // Center-Wechsel mitten im Abarbeiten und zurueck
+        for (int x = -8; x <= 8; ++x) q.Push({ x, x });
+        q.SetCenter({ -8, -8 });
+        ChunkKey k;
+        q.TryPop(k);
+        Check(k.cx == -8 && k.cz == -8, "re-prioritised towards the far corner");
+        q.SetCenter({ 0, 0 });
+        q.TryPop(k);
+        Check(k.cx == 0 && k.cz == 0, "and back to the origin");
+        q.Clear();
+    }
+
+    void CheckDedupAndRemove() {
+        std::printf("dedup / remove\n");
+        DirtyChunkQueue q;
+        q.SetCenter({ 0, 0 });
+        for (int i = 0; i < 5; ++i) q.Push({ 2, 3 });
+        q.Push({ 1, 1 });
+        Check(q.Size() == 2, "repeated push of one key counted once");
+
+        Check(q.Remove({ 2, 3 }), "remove returns true for a queued key");
+        Check(!q.Remove({ 2, 3 }), "second remove returns false");
+        Check(!q.Contains({ 2, 3 }), "removed key no longer contained");
+
+        // Verworfener Key bleibt im Ring liegen; erneut eingereiht darf er nur einmal kommen
+        q.Push({ 2, 3 });
+        ChunkKey k;
+        int popped23 = 0, total = 0;
+        while (q.TryPop(k)) {
+            ++total;
+            if (k.cx == 2 && k.cz == 3) ++popped23;
+        }
+        Check(total == 2 && popped23 == 1, "re-pushed key after remove popped exactly once");
+        Check(q.Empty() && !q.TryPop(k), "empty queue pops nothing");
+    }
+
+    void CheckRandom() {
+        std::printf("random run against a linear-scan reference\n");
+        DirtyChunkQueue q;
+        std::set<std::pair<int, int>> ref;
+        std::mt19937 rng(3);
+        ChunkKey center{ 0, 0 };
+        int bad = 0;
+
+        for (int it = 0; it < 200000; ++it) {
+            const int op = int(rng() % 10);
+            const ChunkKey k{ int(rng() % 41) - 20, int(rng() % 41) - 20 };
+            if (op < 5) {
+                q.Push(k);
+                ref.insert({ k.cx, k.cz });
+            }
+            else if (op < 6) {
+                if (q.Remove(k) != (ref.erase({ k.cx, k.cz }) != 0)) ++bad;
+            }
+            else if (op < 7) {
+                center = { int(rng() % 11) - 5, int(rng() % 11) - 5 };
+                q.SetCenter(center);
+            }
+            else {
+                ChunkKey out;
+                const bool got = q.TryPop(out);
+                if (got == ref.empty()) { ++bad; continue; }
+                if (!got) continue;
+                int best = 1 << 30;
+                for (const auto& p : ref) best = std::min(best, Ring({ p.first, p.second }, center));
+                if (Ring(out, center) != best || !ref.erase({ out.cx, out.cz })) ++bad;
+            }
+            if (q.Size() != ref.size()) ++bad;
+        }
+        Check(bad == 0, "200k push/remove/move/pop operations match");
+    }
+
+} // namespace
+
+int main() {
+    CheckOrder();
+    CheckDedupAndRemove();
+    CheckRandom();
+    std::printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
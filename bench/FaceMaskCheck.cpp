@@ -0,0 +1,76 @@
+// Face-Mask-Pruefung: der eingebaute Kernel (FaceMaskKernelName: avx2/sse2/scalar, je nach
+// Build-Option) gegen eine Voxel-fuer-Voxel-Referenz auf zufaelligen Chunks verschiedener
+// Dichte, inklusive Rand aus den Nachbarn und Bits an den 64-Bit-Wortgrenzen.
+// Mit BRICKWORLDS_ENABLE_AVX2=ON gebaut prueft dasselbe Programm den AVX2-Pfad.
+// Exit-Code 1 bei Abweichung.
+#include <BrickWorlds/Voxel/FaceMask.h>
+#include <BrickWorlds/Voxel/PackedVertex.h>
+
+#include <cstdio>
+#include <memory>
+#include <random>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    constexpr int Chunks = 200;
+
+    // Seite sichtbar = Voxel belegt und Nachbar in dieser Richtung nicht; ueber/unter der Welt ist Air
+    bool Reference(const ChunkOccupancy& occ, int face, int lx, int y, int lz) {
+        if (!occ.At(lx, lz).Test(y)) return false;
+        switch (face) {
+        case FacePlusZ: return !occ.At(lx, lz + 1).Test(y);
+        case FaceMinusZ: return !occ.At(lx, lz - 1).Test(y);
+        case FacePlusY: return y == ChunkY - 1 || !occ.At(lx, lz).Test(y + 1);
+        case FaceMinusY: return y == 0 || !occ.At(lx, lz).Test(y - 1);
+        case FacePlusX: return !occ.At(lx + 1, lz).Test(y);
+        default: return !occ.At(lx - 1, lz).Test(y);
+        }
+    }
+
+    void Randomize(ChunkOccupancy& occ, std::mt19937_64& rng, int density) {
+        for (ColumnMask& c : occ.cols) {
+            for (std::uint64_t& w : c.w) {
+                // density 0..4: Anzahl UND-verknuepfter Zufallsworte -> ~1/2^density belegt,
+                // 5 = voll, dazu gezielt die Wortgrenzen-Bits
+                if (density >= 5) { w = ~std::uint64_t{ 0 }; continue; }
+                w = rng();
+                for (int i = 0; i < density; ++i) w &= rng();
+                if (rng() & 1) w |= (std::uint64_t{ 1 } << 63) | 1u;
+            }
+        }
+    }
+
+} // namespace
+
+int main() {
+    auto occ = std::make_unique<ChunkOccupancy>();
+    auto masks = std::make_unique<ChunkFaceMasks>();
+    std::mt19937_64 rng(3);
+
+    std::size_t mismatches = 0;
+    std::size_t visible = 0;
+    for (int n = 0; n < Chunks; ++n) {
+        Randomize(*occ, rng, n % 6);
+        ComputeFaceMasks(*occ, *masks);
+
+        for (int face = 0; face < MeshFaceCount; ++face)
+            for (int lz = 0; lz < ChunkZ; ++lz)
+                for (int lx = 0; lx < ChunkX; ++lx)
+                    for (int y = 0; y < ChunkY; ++y) {
+                        const bool want = Reference(*occ, face, lx, y, lz);
+                        const bool got = masks->At(face, lx, lz).Test(y);
+                        visible += got ? 1 : 0;
+                        if (got == want) continue;
+                        if (++mismatches <= 10) {
+                            std::printf("  FAIL chunk %d face %d (%d %d %d): got %d want %d\n", n, face, lx, y, lz,
+                                int(got), int(want));
+                        }
+                    }
+    }
+
+    std::printf("face mask kernel %s: %d random chunks, %zu visible faces, %zu mismatches, %s\n",
+        FaceMaskKernelName(), Chunks, visible, mismatches, mismatches ? "FAILED" : "all checks passed");
+    return mismatches ? 1 : 0;
+}
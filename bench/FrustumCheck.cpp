@@ -0,0 +1,133 @@
+// Frustum-Pruefung: Einzeltest (intersects) fuer Boxen innen, aussen und auf einer Ebene,
+// Batch-Pfad (cull, SSE bzw. skalar) gegen den Einzeltest bei Anzahlen, die keine
+// Vielfachen von 4 sind, und Konservativitaet: keine Box mit einer Ecke im Clip-Raum
+// wird verworfen. Exit-Code 1 bei Abweichung.
+#include <BrickWorlds/Core/Frustum.h>
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace BrickWorlds::Core;
+
+namespace {
+
+    int failures = 0;
+
+    void Check(bool ok, const char* what) {
+        std::printf("  %-52s %s\n", what, ok ? "ok" : "FAIL");
+        if (!ok) ++failures;
+    }
+
+    // Spaltenweise 4x4 (wie Camera): out = m * v
+    void Transform(const float* m, const float* v, float* out) {
+        for (int r = 0; r < 4; ++r) {
+            out[r] = 0.0f;
+            for (int k = 0; k < 4; ++k) out[r] += m[k * 4 + r] * v[k];
+        }
+    }
+
+    // Kamera bei (0, 60, 0), Blick nach -Z, 70 Grad vertikal, 16:9, near 0.1, far 1000
+    struct Camera {
+        float view[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, -60, 0, 1 };
+        float proj[16] = {};
+        float viewProj[16] = {};
+
+        Camera() {
+            const float t = std::tan(35.0f * 3.14159265f / 180.0f);
+            const float n = 0.1f, f = 1000.0f;
+            proj[0] = 1.0f / (16.0f / 9.0f * t);
+            proj[5] = 1.0f / t;
+            proj[10] = -(f + n) / (f - n);
+            proj[11] = -1.0f;
+            proj[14] = -2.0f * f * n / (f - n);
+            for (int c = 0; c < 4; ++c) Transform(proj, view + c * 4, viewProj + c * 4);
+        }
+
+        // Ecke liegt echt im Clip-Raum -> Box muss sichtbar sein
+        bool AnyCornerInside(const Aabb& a) const {
+            for (int c = 0; c < 8; ++c) {
+                const float p[4] = { c & 1 ? a.maxX : a.minX, c & 2 ? a.maxY : a.minY, c & 4 ? a.maxZ : a.minZ, 1.0f };
+                float o[4];
+                Transform(viewProj, p, o);
+                if (o[3] > 0.0f && std::fabs(o[0]) < o[3] && std::fabs(o[1]) < o[3] && std::fabs(o[2]) < o[3]) return true;
+            }
+            return false;
+        }
+    };
+
+    void CheckSingle(const Frustum& frustum) {
+        std::printf("single box\n");
+        Check(frustum.intersects({ -8, 50, -60, 8, 70, -40 }), "inside: box ahead of the camera");
+        Check(frustum.intersects({ -4, 56, -4, 4, 64, 4 }), "inside: box around the camera");
+        Check(!frustum.intersects({ -8, 50, 20, 8, 70, 36 }), "outside: box behind the camera");
+        Check(!frustum.intersects({ -8, 50, -1200, 8, 70, -1100 }), "outside: box beyond the far plane");
+        Check(!frustum.intersects({ -600, 50, -60, -500, 70, -40 }), "outside: box left of the frustum");
+        Check(!frustum.intersects({ -8, 200, -60, 8, 220, -40 }), "outside: box above the frustum");
+        // Linke Ebene bei z = -100 liegt bei x = -100 * 16/9 * tan(35) ~ -124.5
+        Check(frustum.intersects({ -140, 50, -110, -110, 70, -90 }), "straddling: box across the left plane");
+        Check(frustum.intersects({ -8, 50, -1010, 8, 70, -990 }), "straddling: box across the far plane");
+        Check(frustum.intersects({ -8, 50, -10, 8, 70, 10 }), "straddling: box across the near plane");
+    }
+
+    void CheckBatch(const Frustum& frustum, const Camera& camera) {
+        std::printf("batch (%s) vs single\n", Frustum::cullKernelName());
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> pos(-600.0f, 600.0f);
+        std::uniform_real_distribution<float> size(1.0f, 64.0f);
+
+        std::size_t mismatches = 0, countErrors = 0, wrongCulls = 0, total = 0;
+        AabbBatch batch;
+        std::vector<Aabb> boxes;
+        std::vector<std::uint8_t> visible;
+        // 0..9 Boxen decken jeden Rest der 4er-Gruppen ab, 10003 einen langen Lauf mit Rest 3
+        for (std::size_t count : { 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10003u }) {
+            batch.clear();
+            boxes.clear();
+            for (std::size_t i = 0; i < count; ++i) {
+                const float x = pos(rng), y = pos(rng) * 0.2f + 60.0f, z = pos(rng);
+                const Aabb box{ x, y, z, x + size(rng), y + size(rng), z + size(rng) };
+                boxes.push_back(box);
+                batch.add(box);
+            }
+
+            const std::size_t n = frustum.cull(batch, visible);
+            std::size_t sum = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                const bool v = visible[i] != 0;
+                sum += v ? 1 : 0;
+                if (v != frustum.intersects(boxes[i])) ++mismatches;
+                if (!v && camera.AnyCornerInside(boxes[i])) ++wrongCulls;
+            }
+            if (visible.size() < count || sum != n) ++countErrors;
+            total += count;
+        }
+        std::printf("  %zu boxes in 11 batches\n", total);
+        Check(mismatches == 0, "batch result equals intersects() for every box");
+        Check(countErrors == 0, "returned count equals the visible flags");
+        Check(wrongCulls == 0, "no box with a corner inside the clip volume culled");
+    }
+
+} // namespace
+
+int main() {
+    const Camera camera;
+    const Frustum frustum = Frustum::fromMatrices(camera.proj, camera.view);
+    CheckSingle(frustum);
+    CheckBatch(frustum, camera);
+
+    // Beide Fabriken liefern dieselben Ebenen
+    const Frustum fromVp = Frustum::fromViewProjection(camera.viewProj);
+    bool same = true;
+    for (int i = 0; i < Frustum::PlaneCount; ++i) {
+        const Frustum::Plane& a = frustum.plane(i);
+        const Frustum::Plane& b = fromVp.plane(i);
+        same &= std::fabs(a.a - b.a) < 1e-4f && std::fabs(a.b - b.b) < 1e-4f && std::fabs(a.c - b.c) < 1e-4f &&
+            std::fabs(a.d - b.d) < 1e-3f;
+    }
+    Check(same, "fromMatrices equals fromViewProjection");
+
+    std::printf("%s\n", failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,96 @@
+// Mesh-Kernel-Benchmark: Padded-Kopie, Belegungsmasken, Bitmask-Face-Culling und kompletter Build
+// fuer einen einzelnen 16x256x16-Chunk auf einem Kern (Ziel: deutlich unter 1 ms).
+#include <BrickWorlds/Voxel/ChunkMesher.h>
+#include <BrickWorlds/Voxel/FaceMask.h>
+#include <BrickWorlds/Voxel/FlatGenerator.h>
+
+#include "BenchTerrain.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int Iterations = 200;
+
+    // Chunk (0, 0) plus 4 Nachbarn
+    struct Neighborhood {
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        MeshNeighborhood n;
+    };
+
+    Neighborhood Generate(IChunkGenerator& gen) {
+        static constexpr int Offsets[5][2] = { { 0, 0 }, { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        Neighborhood nb;
+        for (const auto& o : Offsets) {
+            auto ch = std::make_unique<Chunk>(ChunkKey{ o[0], o[1] });
+            gen.Generate(*ch);
+            ch->BlocksUnsafe().Compact();
+            ch->PublishUnsafe();
+            nb.chunks.push_back(std::move(ch));
+        }
+        nb.n = MeshNeighborhood{ ChunkKey{ 0, 0 }, nb.chunks[0]->View(), nb.chunks[1]->View(),
+            nb.chunks[2]->View(), nb.chunks[3]->View(), nb.chunks[4]->View() };
+        return nb;
+    }
+
+    // Bester Durchlauf in ms
+    template <typename Fn>
+    double Best(Fn&& fn) {
+        double best = 1e30;
+        for (int i = 0; i < Iterations; ++i) {
+            const auto t0 = Clock::now();
+            fn();
+            const auto t1 = Clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+        }
+        return best;
+    }
+
+    void Report(const char* name, IChunkGenerator& gen) {
+        const Neighborhood nb = Generate(gen);
+        PaddedChunk padded;
+        auto occ = std::make_unique<ChunkOccupancy>();
+        auto faces = std::make_unique<ChunkFaceMasks>();
+        ChunkMeshData data;
+
+        const double copyMs = Best([&] { CopyPadded(nb.n, padded); });
+        const double occMs = Best([&] { BuildOccupancy(padded, *occ); });
+        const double kernelMs = Best([&] { ComputeFaceMasks(*occ, *faces); });
+
+        std::size_t visible = 0;
+        for (const auto& face : faces->faces)
+            for (const ColumnMask& m : face) visible += static_cast<std::size_t>(m.Count());
+
+        const ChunkMesher naive(MeshMode::Naive);
+        const ChunkMesher greedy(MeshMode::Greedy);
+        const double naiveMs = Best([&] { naive.Build(nb.n, data); });
+        const double greedyMs = Best([&] { greedy.Build(nb.n, data); });
+
+        std::printf("%s (one chunk, best of %d)\n", name, Iterations);
+        std::printf("  visible faces:   %zu\n", visible);
+        std::printf("  padded copy:     %8.4f ms\n", copyMs);
+        std::printf("  occupancy:       %8.4f ms\n", occMs);
+        std::printf("  face kernel:     %8.4f ms\n", kernelMs);
+        std::printf("  build (naive):   %8.4f ms\n", naiveMs);
+        std::printf("  build (greedy):  %8.4f ms\n", greedyMs);
+    }
+
+} // namespace
+
+int main() {
+    std::printf("face mask kernel: %s\n\n", FaceMaskKernelName());
+
+    FlatGenerator flat;
+    BrickWorlds::Bench::NoiseGenerator noise;
+    Report("flat terrain", flat);
+    Report("noise terrain", noise);
+    return 0;
+}
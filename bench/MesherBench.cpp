@@ -0,0 +1,235 @@
+// Mesher-Benchmark: naiver Face-Culling-Mesher vs. Greedy-Meshing auf FlatGenerator-,
+// Noise- und Zufalls-Terrain, headless ohne GL. Pro Szenario: Chunks/s, ms pro Chunk,
+// ns pro Voxel, Quads/Vertices pro Chunk und Heap-Allokationen pro Mesh; dazu
+// Greedy-LOD-Meshes und das Vertex-Budget fuer grosse Sichtweiten.
+//
+//   bench_mesher [--json <datei>]     (--json - = JSON auf stdout statt Tabelle)
+//
+// Das JSON ist fuer Regressions-Tracking gedacht: ein Eintrag pro Terrain/Modus/LOD.
+#include <BrickWorlds/Voxel/ChunkMesher.h>
+#include <BrickWorlds/Voxel/FaceMask.h>
+#include <BrickWorlds/Voxel/FlatGenerator.h>
+
+#include "BenchTerrain.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// Allokationszaehler fuer den ganzen Prozess (nur dieses Bench-Binary)
+static std::atomic<std::size_t> g_allocations{ 0 };
+
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int Radius = 2;        // gemeshte Chunks: 5x5, Daten fuer 7x7
+    constexpr int Runs = 5;
+    constexpr int LodStart = 6;      // wie der Client
+
+    struct Area {
+        int size = 0;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+
+        const Chunk& At(int cx, int cz) const {
+            return *chunks[static_cast<std::size_t>((cz + size / 2) * size + (cx + size / 2))];
+        }
+    };
+
+    Area Generate(IChunkGenerator& gen) {
+        Area area;
+        area.size = 2 * (Radius + 1) + 1;
+        const int half = area.size / 2;
+        for (int cz = -half; cz <= half; ++cz)
+            for (int cx = -half; cx <= half; ++cx) {
+                auto ch = std::make_unique<Chunk>(ChunkKey{ cx, cz });
+                gen.Generate(*ch);
+                ch->BlocksUnsafe().Compact();
+                ch->BlocksUnsafe().RecomputeHeights();
+                ch->PublishUnsafe();
+                area.chunks.push_back(std::move(ch));
+            }
+        return area;
+    }
+
+    MeshNeighborhood Neighborhood(const Area& area, int cx, int cz) {
+        return MeshNeighborhood{ ChunkKey{ cx, cz }, area.At(cx, cz).View(),
+            area.At(cx - 1, cz).View(), area.At(cx + 1, cz).View(),
+            area.At(cx, cz - 1).View(), area.At(cx, cz + 1).View() };
+    }
+
+    struct Result {
+        std::string terrain;
+        MeshMode mode = MeshMode::Greedy;
+        int lod = 0;
+        std::size_t quads = 0;
+        std::size_t vertices = 0;
+        std::size_t bytes = 0;
+        double msPerChunk = 0.0;
+        double allocationsPerMesh = 0.0;
+
+        double ChunksPerSec() const { return 1000.0 / msPerChunk; }
+        double NsPerVoxel() const { return msPerChunk * 1e6 / ChunkVolume; }
+    };
+
+    // lod 0 = normaler Build. Erster Durchlauf waermt Scratch und Mesh-Puffer auf,
+    // Allokationen zaehlen nur in den gemessenen Durchlaeufen (Steady State der Mesh-Worker).
+    Result Measure(const Area& area, MeshMode mode, int lod = 0) {
+        const ChunkMesher mesher(mode);
+        ChunkMeshData data;
+        Result r;
+        r.mode = mode;
+        r.lod = lod;
+        double best = 1e30;
+        std::size_t allocations = 0;
+        const int chunks = (2 * Radius + 1) * (2 * Radius + 1);
+
+        for (int run = -1; run < Runs; ++run) {
+            std::size_t quads = 0, vertices = 0, bytes = 0;
+            const std::size_t allocs0 = g_allocations.load(std::memory_order_relaxed);
+            const auto t0 = Clock::now();
+            for (int cz = -Radius; cz <= Radius; ++cz)
+                for (int cx = -Radius; cx <= Radius; ++cx) {
+                    mesher.BuildLod(Neighborhood(area, cx, cz), lod, data);
+                    quads += data.QuadCount();
+                    vertices += data.VertexCount();
+                    bytes += data.ByteSize();
+                }
+            const auto t1 = Clock::now();
+            if (run < 0) continue;
+
+            allocations += g_allocations.load(std::memory_order_relaxed) - allocs0;
+            best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+            r.quads = quads / chunks;
+            r.vertices = vertices / chunks;
+            r.bytes = bytes / chunks;
+        }
+        r.msPerChunk = best / chunks;
+        r.allocationsPerMesh = static_cast<double>(allocations) / (Runs * chunks);
+        return r;
+    }
+
+    const char* ModeName(MeshMode mode) { return mode == MeshMode::Greedy ? "greedy" : "naive"; }
+
+    void PrintRow(const char* label, const Result& r) {
+        std::printf("  %-8s %9zu %9zu %10zu %9.3f %10.0f %8.2f %8.1f\n", label, r.quads, r.vertices, r.bytes,
+            r.msPerChunk, r.ChunksPerSec(), r.NsPerVoxel(), r.allocationsPerMesh);
+    }
+
+    void Report(const char* name, IChunkGenerator& gen, bool print, std::vector<Result>& results) {
+        const Area area = Generate(gen);
+        Result naive = Measure(area, MeshMode::Naive);
+        Result greedy = Measure(area, MeshMode::Greedy);
+        naive.terrain = greedy.terrain = name;
+        results.push_back(naive);
+        results.push_back(greedy);
+
+        if (print) {
+            std::printf("%s terrain (per chunk, %dx%d chunks)\n", name, 2 * Radius + 1, 2 * Radius + 1);
+            std::printf("  %-8s %9s %9s %10s %9s %10s %8s %8s\n", "mode", "quads", "vertices", "bytes", "ms",
+                "chunks/s", "ns/voxel", "allocs");
+            PrintRow("naive", naive);
+            PrintRow("greedy", greedy);
+        }
+
+        std::size_t lodVertices[MaxLod + 1] = { greedy.vertices };
+        for (int lod = 1; lod <= MaxLod; ++lod) {
+            Result r = Measure(area, MeshMode::Greedy, lod);
+            r.terrain = name;
+            lodVertices[lod] = r.vertices;
+            results.push_back(r);
+            if (print) {
+                char label[16];
+                std::snprintf(label, sizeof(label), "lod %dx", LodScale(lod));
+                PrintRow(label, r);
+            }
+        }
+        if (!print) return;
+
+        std::printf("  vertex reduction: %.1fx, time ratio greedy/naive: %.2f\n",
+            static_cast<double>(naive.vertices) / static_cast<double>(std::max<std::size_t>(1, greedy.vertices)),
+            greedy.msPerChunk / naive.msPerChunk);
+
+        // Vertices aller Chunks bis zur Sichtweite (Quadrat-Ringe), LOD wie World::SetLodDistance
+        auto budget = [&](int viewDistance, int lodDistance) {
+            double total = 0.0;
+            for (int d = 0; d <= viewDistance; ++d) {
+                int lod = 0;
+                if (lodDistance > 0)
+                    for (int limit = lodDistance; d > limit && lod < MaxLod; limit *= 2) ++lod;
+                total += static_cast<double>(d == 0 ? 1 : 8 * d) * static_cast<double>(lodVertices[lod]);
+            }
+            return total;
+        };
+        std::printf("  vertex budget: view 6 %.0fk, view 24 %.0fk, view 24 + LOD from 6 %.0fk\n",
+            budget(6, 0) / 1000.0, budget(24, 0) / 1000.0, budget(24, LodStart) / 1000.0);
+    }
+
+    void WriteJson(std::FILE* f, const std::vector<Result>& results) {
+        std::fprintf(f, "{\n");
+        std::fprintf(f, "  \"benchmark\": \"bench_mesher\",\n");
+        std::fprintf(f, "  \"faceMaskKernel\": \"%s\",\n", FaceMaskKernelName());
+        std::fprintf(f, "  \"chunksPerRun\": %d,\n", (2 * Radius + 1) * (2 * Radius + 1));
+        std::fprintf(f, "  \"runs\": %d,\n", Runs);
+        std::fprintf(f, "  \"results\": [\n");
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            std::fprintf(f,
+                "    { \"terrain\": \"%s\", \"mode\": \"%s\", \"lod\": %d, \"chunksPerSec\": %.1f, \"msPerChunk\": %.5f, "
+                "\"nsPerVoxel\": %.3f, \"quadsPerChunk\": %zu, \"verticesPerChunk\": %zu, \"bytesPerChunk\": %zu, "
+                "\"allocationsPerMesh\": %.2f }%s\n",
+                r.terrain.c_str(), ModeName(r.mode), r.lod, r.ChunksPerSec(), r.msPerChunk, r.NsPerVoxel(),
+                r.quads, r.vertices, r.bytes, r.allocationsPerMesh, i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(f, "  ]\n}\n");
+    }
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* jsonPath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) jsonPath = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--json <file>|-]\n", argv[0]);
+            return 2;
+        }
+    }
+    const bool jsonToStdout = jsonPath && std::strcmp(jsonPath, "-") == 0;
+
+    FlatGenerator flat;
+    BrickWorlds::Bench::NoiseGenerator noise;
+    BrickWorlds::Bench::RandomGenerator random;
+
+    std::vector<Result> results;
+    Report("flat", flat, !jsonToStdout, results);
+    Report("noise", noise, !jsonToStdout, results);
+    Report("random", random, !jsonToStdout, results);
+
+    if (!jsonPath) return 0;
+    std::FILE* f = jsonToStdout ? stdout : std::fopen(jsonPath, "w");
+    if (!f) {
+        std::fprintf(stderr, "cannot write %s\n", jsonPath);
+        return 1;
+    }
+    WriteJson(f, results);
+    if (!jsonToStdout) std::fclose(f);
+    return 0;
+}
@@ -0,0 +1,70 @@
+// Vertex-Format-Pruefung: PackVertex/UnpackVertex fuer jedes Feld an seinen Grenzen
+// (x/z 0..16, y 0..256, alle Seiten, AO 0..3, BlockId bis 0xffff) und ohne Uebersprechen
+// zwischen den Feldern. Exit-Code 1 bei Abweichung.
+#include <BrickWorlds/Voxel/PackedVertex.h>
+
+#include <cstdio>
+#include <random>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    int failures = 0;
+
+    bool Same(const UnpackedVertex& a, const UnpackedVertex& b) {
+        return a.x == b.x && a.y == b.y && a.z == b.z && a.face == b.face && a.ao == b.ao && a.id == b.id;
+    }
+
+    void RoundTrip(const UnpackedVertex& in) {
+        const UnpackedVertex out = UnpackVertex(PackVertex(in.x, in.y, in.z, in.face, in.id, in.ao));
+        if (Same(in, out)) return;
+        if (++failures <= 10) {
+            std::printf("  FAIL in (%d %d %d f%d ao%d id%u) out (%d %d %d f%d ao%d id%u)\n", in.x, in.y, in.z,
+                in.face, in.ao, unsigned(in.id), out.x, out.y, out.z, out.face, out.ao, unsigned(out.id));
+        }
+    }
+
+} // namespace
+
+int main() {
+    // Grenzwerte jedes Feldes kombiniert
+    const int xs[] = { 0, 1, ChunkX - 1, ChunkX };
+    const int ys[] = { 0, 1, ChunkY - 1, ChunkY };
+    const int zs[] = { 0, 1, ChunkZ - 1, ChunkZ };
+    const BlockId ids[] = { Air, 1, 0x7fff, 0xffff };
+    std::size_t cases = 0;
+    for (int x : xs)
+        for (int y : ys)
+            for (int z : zs)
+                for (int face = 0; face < MeshFaceCount; ++face)
+                    for (int ao = 0; ao <= VertexAoNone; ++ao)
+                        for (BlockId id : ids) {
+                            RoundTrip({ x, y, z, face, ao, id });
+                            ++cases;
+                        }
+
+    // Zufaellige Vertices ueber den ganzen Wertebereich
+    std::mt19937 rng(7);
+    for (int i = 0; i < 100000; ++i) {
+        RoundTrip({ int(rng() % (ChunkX + 1)), int(rng() % (ChunkY + 1)), int(rng() % (ChunkZ + 1)),
+            int(rng() % MeshFaceCount), int(rng() % (VertexAoNone + 1)), BlockId(rng() & 0xffffu) });
+        ++cases;
+    }
+
+    // Oberste 8 Bit von position und obere 16 Bit von block bleiben frei (Client: Arena-Handle)
+    const PackedVertex max = PackVertex(ChunkX, ChunkY, ChunkZ, MeshFaceCount - 1, 0xffff, VertexAoNone);
+    if ((max.position >> (VertexAoShift + VertexAoBits)) != 0 || (max.block >> 16) != 0) {
+        std::printf("  FAIL reserved bits used (position 0x%08x, block 0x%08x)\n", max.position, max.block);
+        ++failures;
+    }
+    PackedVertex tagged = max;
+    tagged.block |= 0xabcdu << 16;
+    if (!Same(UnpackVertex(tagged), UnpackVertex(max))) {
+        std::printf("  FAIL arena handle in block leaks into the BlockId\n");
+        ++failures;
+    }
+
+    std::printf("packed vertex: %zu round trips, %s\n", cases, failures ? "FAILED" : "all checks passed");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,119 @@
+// Remesh-Benchmark: Einzel-Edits an der Oberflaeche (Bauen/Abbauen) mit komplettem
+// Chunk-Remesh vs. inkrementellem Remesh der betroffenen Section-Buckets.
+// Ausgabe: ms pro Remesh und daraus die Edits/s, die ein Mesh-Worker im 60-Hz-Takt schafft.
+#include <BrickWorlds/Voxel/ChunkMesher.h>
+
+#include "BenchTerrain.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int Edits = 2000;
+    constexpr double FrameMs = 1000.0 / 60.0;
+
+    double Ms(Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+    struct Result {
+        double fullMs = 0.0;
+        double incrementalMs = 0.0;
+        std::size_t bucketsPerEdit = 0;
+    };
+
+    Result Run(MeshMode mode) {
+        BrickWorlds::Bench::NoiseGenerator gen;
+
+        // Chunk (0, 0) plus 4 Nachbarn
+        static constexpr int Offsets[5][2] = { { 0, 0 }, { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        for (const auto& o : Offsets) {
+            auto ch = std::make_unique<Chunk>(ChunkKey{ o[0], o[1] });
+            gen.Generate(*ch);
+            ch->BlocksUnsafe().Compact();
+            ch->PublishUnsafe();
+            chunks.push_back(std::move(ch));
+        }
+        Chunk& center = *chunks[0];
+        auto neighborhood = [&] {
+            return MeshNeighborhood{ center.Key(), center.View(), chunks[1]->View(),
+                chunks[2]->View(), chunks[3]->View(), chunks[4]->View() };
+        };
+
+        // Oberflaeche je Spalte: Edits landen dort, wo gebaut und abgebaut wird
+        int surface[ChunkZ][ChunkX];
+        for (int lz = 0; lz < ChunkZ; ++lz)
+            for (int lx = 0; lx < ChunkX; ++lx) {
+                int y = ChunkY - 1;
+                while (y > 0 && center.Get(lx, y, lz) == Air) --y;
+                surface[lz][lx] = y;
+            }
+
+        const ChunkMesher mesher(mode);
+        ChunkMeshData mesh, next, full;
+        mesher.Build(neighborhood(), mesh);
+        center.ConsumeDirtyMesh();
+
+        std::mt19937 rng(1234);
+        Result r;
+        double fullMs = 0.0, incrementalMs = 0.0;
+        std::size_t buckets = 0;
+
+        for (int i = 0; i < Edits; ++i) {
+            const int lx = static_cast<int>(rng() % ChunkX);
+            const int lz = static_cast<int>(rng() % ChunkZ);
+            const int ly = std::min(ChunkY - 1, std::max(0, surface[lz][lx] + static_cast<int>(rng() % 5) - 2));
+            center.Set(lx, ly, lz, (rng() % 2) ? Air : Rock);
+
+            const MeshDirtyMask dirty = center.ConsumeDirtyMesh();
+            for (int b = 0; b < MeshBucketCount; ++b) buckets += dirty.Test(b) ? 1 : 0;
+            const MeshNeighborhood n = neighborhood();
+
+            const auto t0 = Clock::now();
+            mesher.Build(n, full);
+            const auto t1 = Clock::now();
+            mesher.Update(n, dirty, mesh, next);
+            const auto t2 = Clock::now();
+            mesh.vertices.swap(next.vertices);
+            std::swap(mesh.bucketStart, next.bucketStart);
+            std::swap(mesh.connectivity, next.connectivity);
+
+            fullMs += Ms(t0, t1);
+            incrementalMs += Ms(t1, t2);
+        }
+
+        r.fullMs = fullMs / Edits;
+        r.incrementalMs = incrementalMs / Edits;
+        r.bucketsPerEdit = buckets / Edits;
+        return r;
+    }
+
+    void Report(const char* name, MeshMode mode) {
+        const Result r = Run(mode);
+        std::printf("%s mesher (%d surface edits, one remesh per edit)\n", name, Edits);
+        std::printf("  dirty buckets per edit: %zu of %d\n", r.bucketsPerEdit, MeshBucketCount);
+        std::printf("  %-12s %10s %14s %12s\n", "remesh", "ms", "edits/frame", "edits/s");
+        std::printf("  %-12s %10.4f %14.0f %12.0f\n", "full", r.fullMs, FrameMs / r.fullMs, 1000.0 / r.fullMs);
+        std::printf("  %-12s %10.4f %14.0f %12.0f\n", "incremental", r.incrementalMs,
+            FrameMs / r.incrementalMs, 1000.0 / r.incrementalMs);
+        std::printf("  speedup: %.1fx\n", r.fullMs / r.incrementalMs);
+    }
+
+} // namespace
+
+int main() {
+    Report("greedy", MeshMode::Greedy);
+    Report("naive", MeshMode::Naive);
+    return 0;
+}
@@ -0,0 +1,106 @@
+// Streaming-Benchmark: Time-to-first-visible-Chunk (Chunk unter dem Spieler ReadyMesh)
+// mit FIFO-Generierung (alt) vs. entfernungspriorisierter Queue mit Cancel.
+// Szenarien: Kaltstart und Teleport direkt nach dem Laden (volle Queue der alten Position).
+#include <BrickWorlds/Voxel/World.h>
+
+#include "BenchTerrain.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    constexpr int ViewDistance = 12;           // 25x25 Chunks
+    constexpr std::size_t Workers = 2;
+    constexpr int TeleportBlocks = 4096;
+
+    // Zaehlt generierte Chunks (verschwendete Arbeit nach Teleport)
+    class CountingGenerator final : public IChunkGenerator {
+    public:
+        void Generate(Chunk& chunk) override {
+            inner_.Generate(chunk);
+            generated_.fetch_add(1, std::memory_order_relaxed);
+        }
+        int Generated() const { return generated_.load(std::memory_order_relaxed); }
+
+    private:
+        BrickWorlds::Bench::NoiseGenerator inner_;
+        std::atomic<int> generated_{ 0 };
+    };
+
+    bool IsReady(const World& world, const ChunkKey& key) {
+        auto ch = world.Chunks().GetChunk(key);
+        return ch && ch->State() == ChunkState::ReadyMesh;
+    }
+
+    bool RingReady(const World& world, const ChunkKey& center, int radius) {
+        for (int dz = -radius; dz <= radius; ++dz)
+            for (int dx = -radius; dx <= radius; ++dx)
+                if (!IsReady(world, { center.cx + dx, center.cz + dz })) return false;
+        return true;
+    }
+
+    struct Result {
+        double firstMs = 0.0;   // Chunk unter dem Spieler
+        double nearMs = 0.0;    // 5x5 um den Spieler
+        int generated = 0;      // generierte Chunks bis dahin
+    };
+
+    Result Measure(bool prioritized, bool teleport) {
+        CountingGenerator gen;
+        World world(&gen);
+        world.SetPrioritizedGeneration(prioritized);
+        world.StartStreaming(Workers);
+
+        int px = 0;
+        world.UpdateStreaming(px, 0, ViewDistance);
+        if (teleport) {
+            px = TeleportBlocks;
+            world.UpdateStreaming(px, 0, ViewDistance);
+        }
+        const auto t0 = Clock::now();
+        const ChunkKey center = World::WorldToChunk(px, 0);
+
+        Result r;
+        bool first = false;
+        for (;;) {
+            if (!first && IsReady(world, center)) {
+                first = true;
+                r.firstMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+            }
+            if (first && RingReady(world, center, 2)) {
+                r.nearMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        r.generated = gen.Generated();
+        world.StopStreaming();
+        return r;
+    }
+
+    void Report(const char* scenario, bool teleport) {
+        const Result fifo = Measure(false, teleport);
+        const Result prio = Measure(true, teleport);
+        std::printf("%s\n", scenario);
+        std::printf("  %-12s %10s %10s %10s\n", "queue", "first ms", "5x5 ms", "generated");
+        std::printf("  %-12s %10.1f %10.1f %10d\n", "fifo", fifo.firstMs, fifo.nearMs, fifo.generated);
+        std::printf("  %-12s %10.1f %10.1f %10d\n", "prioritized", prio.firstMs, prio.nearMs, prio.generated);
+        std::printf("  speedup first visible chunk: %.1fx\n", fifo.firstMs / prio.firstMs);
+    }
+
+} // namespace
+
+int main() {
+    std::printf("time to first visible chunk (view distance %d, %zu workers, noise terrain)\n",
+        ViewDistance, Workers);
+    Report("cold start", false);
+    Report("teleport after load", true);
+    return 0;
+}
@@ -0,0 +1,78 @@
+// Bulk-Edit-Benchmark: Schleife ueber World::SetBlock vs. ApplyEdits/FillBox
+// (Explosion und Fill-Befehl auf vorab gefuelltem Terrain).
+#include <BrickWorlds/Voxel/World.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <vector>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    void PrepareTerrain(World& world) {
+        world.FillBox(-48, 0, -48, 47, 59, 47, Rock);
+    }
+
+    // Bestzeit aus mehreren Laeufen mit frischer Welt (ms)
+    double TimeBest(int runs, const std::function<void(World&)>& fn) {
+        double best = 1e30;
+        for (int r = 0; r < runs; ++r) {
+            World world(nullptr);
+            PrepareTerrain(world);
+
+            const auto t0 = Clock::now();
+            fn(world);
+            const auto t1 = Clock::now();
+            best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+        }
+        return best;
+    }
+
+    void Print(const char* name, std::size_t edits, double ms, double baselineMs) {
+        std::printf("  %-22s %8zu edits %9.2f ms %12.0f edits/s  %5.1fx\n",
+            name, edits, ms, static_cast<double>(edits) / (ms / 1000.0), baselineMs / ms);
+    }
+
+} // namespace
+
+int main() {
+    const int runs = 5;
+
+    // Explosion: Kugel mit Radius 20 wird zu Air
+    std::vector<BlockEdit> explosion;
+    const int r = 20;
+    for (int y = -r; y <= r; ++y)
+        for (int z = -r; z <= r; ++z)
+            for (int x = -r; x <= r; ++x)
+                if (x * x + y * y + z * z <= r * r) explosion.push_back({ x, 40 + y, z, Air });
+
+    std::printf("explosion (sphere r=%d)\n", r);
+    const double loopMs = TimeBest(runs, [&](World& w) {
+        for (auto& e : explosion) w.SetBlock(e.wx, e.wy, e.wz, e.id);
+        });
+    const double batchMs = TimeBest(runs, [&](World& w) { w.ApplyEdits(explosion); });
+    Print("SetBlock loop", explosion.size(), loopMs, loopMs);
+    Print("ApplyEdits", explosion.size(), batchMs, loopMs);
+
+    // Fill-Befehl: 64x32x64 Box mit Dirt
+    const int x0 = -32, y0 = 20, z0 = -32, x1 = 31, y1 = 51, z1 = 31;
+    const std::size_t boxEdits = std::size_t{ 64 } * 32 * 64;
+
+    std::printf("fill (64x32x64 box)\n");
+    const double fillLoopMs = TimeBest(runs, [&](World& w) {
+        for (int y = y0; y <= y1; ++y)
+            for (int z = z0; z <= z1; ++z)
+                for (int x = x0; x <= x1; ++x) w.SetBlock(x, y, z, Dirt);
+        });
+    const double fillMs = TimeBest(runs, [&](World& w) { w.FillBox(x0, y0, z0, x1, y1, z1, Dirt); });
+    const double replaceMs = TimeBest(runs, [&](World& w) { w.ReplaceInBox(x0, y0, z0, x1, y1, z1, Rock, Dirt); });
+    Print("SetBlock loop", boxEdits, fillLoopMs, fillLoopMs);
+    Print("FillBox", boxEdits, fillMs, fillLoopMs);
+    Print("ReplaceInBox", boxEdits, replaceMs, fillLoopMs);
+    return 0;
+}
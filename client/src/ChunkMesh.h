@@ -1,36 +1,37 @@
 #pragma once
 
+#include "GeometryArena.h"
 #include <BrickWorlds/Voxel/Chunk.h>
-#include <BrickWorlds/Voxel/BlockId.h>
-#include <vector>
+#include <BrickWorlds/Voxel/PaddedChunk.h>
 #include <cstdint>
 
-namespace BrickWorlds::Voxel {
-    class World; // <- Forward Declaration (WICHTIG)
-}
-
-struct Vertex {
-    float position[3];
-    float color[3];
-};
-
+// GPU-Seite eines Chunk-Meshes. Die Geometrie baut der ChunkMesher auf den
+// Mesh-Workern (shared), hier wird nur noch hochgeladen und gezeichnet.
+// Vertices sind Chunk-lokal gepackt (8 Byte) und liegen im GeometryArena des Renderers;
+// der Ursprung kommt ueber den Arena-Handle im Vertex (uChunkOrigins).
 class ChunkMesh {
 public:
-    ChunkMesh();
-    ~ChunkMesh();
+    // Altes Mesh im Arena freigeben, neues ablegen (leere Meshes belegen nichts)
+    void upload(const BrickWorlds::Voxel::ChunkMeshData& data, const BrickWorlds::Voxel::ChunkKey& key, GeometryArena& arena);
+    void release(GeometryArena& arena);
 
-    void generate(const BrickWorlds::Voxel::World& world,
-        const BrickWorlds::Voxel::Chunk& chunk);
+    // Nur die Sections in der Maske (Bit sy); benachbarte Sections als ein Eintrag
+    void appendDraws(std::uint32_t sections, const GeometryArena& arena, MultiDrawList& draws) const;
 
-    void render() const;
+    bool isEmpty() const { return m_handle == GeometryArena::InvalidHandle; }
 
-    bool isEmpty() const { return m_vertexCount == 0; }
+    // Belegte Hoehe [minY, maxY) aus den Mesh-Buckets (ganze Sections), fuer die Culling-Box
+    int minY() const { return m_minY; }
+    int maxY() const { return m_maxY; }
 
-private:
-    unsigned int m_vao = 0;
-    unsigned int m_vbo = 0;
-    int m_vertexCount = 0;
+    // Verbindungsgraph pro Section (Cave-Culling), SectionCount Eintraege
+    const std::uint16_t* connectivity() const { return m_connectivity; }
 
-    void addFace(int face, float x, float y, float z, float r, float g, float b, std::vector<Vertex>& vertices);
-    void getBlockColor(BrickWorlds::Voxel::BlockId id, float& r, float& g, float& b);
+private:
+    GeometryArena::Handle m_handle = GeometryArena::InvalidHandle;
+    int m_minY = 0;
+    int m_maxY = 0;
+    // Erster Vertex jeder Section (Buckets liegen nach Section sortiert)
+    std::uint32_t m_sectionStart[BrickWorlds::Voxel::SectionCount + 1] = {};
+    std::uint16_t m_connectivity[BrickWorlds::Voxel::SectionCount] = {};
 };
@@ -0,0 +1,158 @@
+#include "GeometryArena.h"
+#include <GL/glew.h>
+#include <BrickWorlds/Voxel/Chunk.h>
+#include <algorithm>
+#include <cstdint>
+
+using namespace BrickWorlds::Voxel;
+
+namespace {
+    // Handle in den oberen 16 Bit von PackedVertex::block (Shader: aPacked.y >> 16)
+    constexpr int kSlotShift = 16;
+    constexpr std::size_t kMaxHandles = std::size_t(1) << (32 - kSlotShift);
+}
+
+void MultiDrawList::add(std::size_t baseVertex, std::size_t quads) {
+    counts.push_back(int(quads * ChunkMeshData::IndicesPerQuad));
+    indexOffsets.push_back(nullptr);
+    baseVertices.push_back(int(baseVertex));
+}
+
+GeometryArena::~GeometryArena() {
+    if (m_originTexture) glDeleteTextures(1, &m_originTexture);
+    if (m_originBuffer) glDeleteBuffers(1, &m_originBuffer);
+    if (m_vbo) glDeleteBuffers(1, &m_vbo);
+    if (m_vao) glDeleteVertexArrays(1, &m_vao);
+}
+
+bool GeometryArena::initialize(std::size_t initialVertices, unsigned int quadIndexBuffer) {
+    glGenVertexArrays(1, &m_vao);
+    glGenBuffers(1, &m_vbo);
+    glGenBuffers(1, &m_originBuffer);
+    glGenTextures(1, &m_originTexture);
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferData(GL_ARRAY_BUFFER, initialVertices * sizeof(PackedVertex), nullptr, GL_DYNAMIC_DRAW);
+    m_allocator.grow(initialVertices);
+
+    glBindVertexArray(m_vao);
+    // Element-Buffer-Binding ist VAO-State
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, quadIndexBuffer);
+    bindVertexLayout();
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return glGetError() == GL_NO_ERROR;
+}
+
+void GeometryArena::bindVertexLayout() const {
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribIPointer(0, 2, GL_UNSIGNED_INT, sizeof(PackedVertex), (void*)0);
+}
+
+void GeometryArena::relocate(std::size_t newCapacity) {
+    unsigned int target = 0;
+    glGenBuffers(1, &target);
+    glBindBuffer(GL_COPY_READ_BUFFER, m_vbo);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, target);
+    glBufferData(GL_COPY_WRITE_BUFFER, newCapacity * sizeof(PackedVertex), nullptr, GL_DYNAMIC_DRAW);
+
+    // In Offset-Reihenfolge; direkt aufeinanderfolgende Meshes in einer Kopie
+    std::size_t runFrom = 0, runTo = 0, runSize = 0;
+    auto flush = [&] {
+        if (runSize) {
+            glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, GLintptr(runFrom * sizeof(PackedVertex)),
+                GLintptr(runTo * sizeof(PackedVertex)), GLsizeiptr(runSize * sizeof(PackedVertex)));
+        }
+    };
+    m_allocator.compact([&](Handle, std::size_t from, std::size_t to, std::size_t size) {
+        if (runSize && from == runFrom + runSize) {
+            runSize += size;
+            return;
+        }
+        flush();
+        runFrom = from;
+        runTo = to;
+        runSize = size;
+    });
+    flush();
+    m_allocator.grow(newCapacity);
+
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    glDeleteBuffers(1, &m_vbo);
+    m_vbo = target;
+
+    glBindVertexArray(m_vao);
+    bindVertexLayout();
+    glBindVertexArray(0);
+    ++m_relocations;
+}
+
+GeometryArena::Handle GeometryArena::upload(const PackedVertex* vertices, std::size_t count, int originX, int originZ) {
+    if (count == 0) return InvalidHandle;
+
+    Handle handle = m_allocator.allocate(count);
+    if (handle == InvalidHandle) {
+        // Genug Platz, nur zerstueckelt -> kompaktieren; sonst verdoppeln
+        std::size_t capacity = m_allocator.capacity();
+        if (m_allocator.freeSpace() < count + capacity / 4) {
+            capacity = std::max<std::size_t>(capacity * 2, 1024);
+            while (capacity - m_allocator.stats().used < count + capacity / 4) capacity *= 2;
+        }
+        relocate(capacity);
+        handle = m_allocator.allocate(count);
+    }
+    if (handle == InvalidHandle) return InvalidHandle;
+    if (handle >= kMaxHandles) {
+        m_allocator.release(handle);
+        return InvalidHandle;
+    }
+
+    m_scratch.assign(vertices, vertices + count);
+    for (PackedVertex& v : m_scratch) v.block |= std::uint32_t(handle) << kSlotShift;
+
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glBufferSubData(GL_ARRAY_BUFFER, GLintptr(m_allocator.offset(handle) * sizeof(PackedVertex)),
+        GLsizeiptr(count * sizeof(PackedVertex)), m_scratch.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    // Ursprung fuer den Shader; Buffer-Texture waechst mit der Zahl der Handles
+    if (m_origins.size() < (handle + 1) * 2) m_origins.resize((handle + 1) * 2, 0);
+    m_origins[handle * 2 + 0] = originX;
+    m_origins[handle * 2 + 1] = originZ;
+
+    glBindBuffer(GL_TEXTURE_BUFFER, m_originBuffer);
+    if (handle >= m_originCapacity) {
+        m_originCapacity = std::max<std::size_t>(m_originCapacity * 2, 1024);
+        while (m_originCapacity <= handle) m_originCapacity *= 2;
+        m_origins.resize(m_originCapacity * 2, 0);
+        glBufferData(GL_TEXTURE_BUFFER, m_origins.size() * sizeof(std::int32_t), m_origins.data(), GL_DYNAMIC_DRAW);
+        glBindTexture(GL_TEXTURE_BUFFER, m_originTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RG32I, m_originBuffer);
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+    }
+    else {
+        glBufferSubData(GL_TEXTURE_BUFFER, GLintptr(handle * 2 * sizeof(std::int32_t)), 2 * sizeof(std::int32_t),
+            &m_origins[handle * 2]);
+    }
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    return handle;
+}
+
+void GeometryArena::release(Handle handle) {
+    m_allocator.release(handle);
+}
+
+void GeometryArena::draw(const MultiDrawList& draws) const {
+    if (draws.size() == 0) return;
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, m_originTexture);
+    glBindVertexArray(m_vao);
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, draws.counts.data(), GL_UNSIGNED_INT,
+        draws.indexOffsets.data(), GLsizei(draws.size()), draws.baseVertices.data());
+    glBindVertexArray(0);
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <BrickWorlds/Core/ArenaAllocator.h>
+#include <BrickWorlds/Voxel/PackedVertex.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Draw-Liste fuer einen glMultiDrawElementsBaseVertex: je Eintrag ein Lauf von Quads ab baseVertex,
+// Indizes immer ab 0 aus dem gemeinsamen Quad-Index-Buffer
+struct MultiDrawList {
+    std::vector<int> counts;
+    std::vector<const void*> indexOffsets;
+    std::vector<int> baseVertices;
+
+    void clear() { counts.clear(); indexOffsets.clear(); baseVertices.clear(); }
+    void add(std::size_t baseVertex, std::size_t quads);
+    std::size_t size() const { return counts.size(); }
+};
+
+// Ein Vertex-Buffer + ein VAO fuer alle Chunk-Meshes. Den Platz vergibt der ArenaAllocator (shared,
+// Einheit = Vertex); reicht er nicht, wird in einen neuen Buffer kompaktiert bzw. vergroessert.
+// Der Ursprung jedes Meshes liegt in einem Buffer-Texture (uChunkOrigins), der Handle steht in den
+// oberen 16 Bit von PackedVertex::block - so braucht ein Draw-Aufruf fuer alle Chunks kein Uniform.
+class GeometryArena {
+public:
+    using Handle = BrickWorlds::Core::ArenaAllocator::Handle;
+    static constexpr Handle InvalidHandle = BrickWorlds::Core::ArenaAllocator::InvalidHandle;
+
+    GeometryArena() = default;
+    ~GeometryArena();
+
+    GeometryArena(const GeometryArena&) = delete;
+    GeometryArena& operator=(const GeometryArena&) = delete;
+
+    // quadIndexBuffer wird VAO-State (der Renderer vergroessert ihn unter gleichem Namen)
+    bool initialize(std::size_t initialVertices, unsigned int quadIndexBuffer);
+
+    // Vertices mit Chunk-Ursprung (Welt-Blocks) ablegen; InvalidHandle bei count == 0
+    Handle upload(const BrickWorlds::Voxel::PackedVertex* vertices, std::size_t count, int originX, int originZ);
+    void release(Handle handle);
+
+    std::size_t baseVertex(Handle handle) const { return m_allocator.offset(handle); }
+
+    // Alle Eintraege mit einem Aufruf; Origin-Texture liegt auf Texture-Unit 0
+    void draw(const MultiDrawList& draws) const;
+
+    const BrickWorlds::Core::ArenaAllocator::Stats& stats() const { return m_allocator.stats(); }
+    std::size_t relocations() const { return m_relocations; }
+
+private:
+    // Neuer Buffer mit newCapacity Vertices, alle Meshes kompakt hineinkopiert
+    void relocate(std::size_t newCapacity);
+    void bindVertexLayout() const;
+
+    BrickWorlds::Core::ArenaAllocator m_allocator;
+    unsigned int m_vao = 0;
+    unsigned int m_vbo = 0;
+    unsigned int m_originBuffer = 0;
+    unsigned int m_originTexture = 0;
+    std::size_t m_originCapacity = 0;              // Handles im Origin-Buffer
+    std::vector<std::int32_t> m_origins;           // x, z je Handle
+    std::vector<BrickWorlds::Voxel::PackedVertex> m_scratch;
+    std::size_t m_relocations = 0;
+};
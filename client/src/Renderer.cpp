@@ -3,20 +3,38 @@
 #include <GL/glew.h>
 #include <algorithm>>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <BrickWorlds/Core/Profiler.h>
+#include <BrickWorlds/Voxel/ChunkMesher.h>
 
 static const char* kVertexShader = R"(
 #version 330 core
-layout(location = 0) in vec3 aPos;
-layout(location = 1) in vec3 aColor;
+// PackedVertex: x.position = x 5 | z 5 | y 9 | face 3 | ao 2, x.block = BlockId 16
+layout(location = 0) in uvec2 aPacked;
 
 uniform mat4 uView;
 uniform mat4 uProjection;
+// Chunk-Ursprung (Welt-Blocks x, z) je Arena-Handle; Handle in den oberen 16 Bit von block
+uniform isamplerBuffer uChunkOrigins;
+uniform vec3 uBlockColors[64];
 
 out vec3 vColor;
 
+const float kFaceShade[6] = float[6](1.0, 0.7, 0.9, 0.5, 0.8, 0.6);
+
 void main() {
-    vColor = aColor;
-    gl_Position = uProjection * uView * vec4(aPos, 1.0);
+    uint p = aPacked.x;
+    vec3 local = vec3(float(p & 31u), float((p >> 10) & 511u), float((p >> 5) & 31u));
+    uint face = (p >> 19) & 7u;
+    uint ao = (p >> 22) & 3u;
+    uint id = aPacked.y & 65535u;
+    ivec2 origin = texelFetch(uChunkOrigins, int(aPacked.y >> 16)).xy;
+
+    vec3 base = (id < 64u) ? uBlockColors[id] : vec3(1.0, 0.0, 1.0);
+    vColor = base * kFaceShade[face] * (0.55 + 0.15 * float(ao));
+    gl_Position = uProjection * uView * vec4(vec3(float(origin.x), 0.0, float(origin.y)) + local, 1.0);
 }
 )";
 
@@ -33,10 +51,10 @@ void main() {
 Renderer::Renderer() {}
 
 Renderer::~Renderer() {
-    for (auto& kv : m_chunkMeshes) {
-        delete kv.second;
-    }
+    // Meshes belegen nur Platz im Arena, das seine Buffer selbst freigibt
     m_chunkMeshes.clear();
+
+    if (m_quadIndexBuffer) glDeleteBuffers(1, &m_quadIndexBuffer);
 }
 
 bool Renderer::initialize() {
@@ -47,75 +65,124 @@ bool Renderer::initialize() {
         std::cerr << "Failed to compile/link embedded shader." << std::endl;
         return false;
     }
-    return true;
-}
-
-void Renderer::updateChunkMeshes(const BrickWorlds::Voxel::World& world, const Camera& camera) {
-    auto chunks = world.Chunks().SnapshotAll();
 
-    // Kamera-Position fr Distanzsortierung
-    auto camPos = camera.getPosition();
-    const int camWx = static_cast<int>(camPos.x);
-    const int camWz = static_cast<int>(camPos.z);
-
-    std::sort(chunks.begin(), chunks.end(),
-        [&](const std::shared_ptr<BrickWorlds::Voxel::Chunk>& a,
-            const std::shared_ptr<BrickWorlds::Voxel::Chunk>& b)
-        {
-            if (!a) return false;
-            if (!b) return true;
+    // Block-Farben als Palette im Shader (Ids >= kBlockColorCount -> Magenta)
+    float colors[kBlockColorCount * 3];
+    for (int id = 0; id < kBlockColorCount; ++id) {
+        BrickWorlds::Voxel::BlockColor(static_cast<BrickWorlds::Voxel::BlockId>(id),
+            colors[id * 3 + 0], colors[id * 3 + 1], colors[id * 3 + 2]);
+    }
+    m_shader.use();
+    m_shader.setVec3Array("uBlockColors", kBlockColorCount, colors);
+    m_shader.setInt("uChunkOrigins", 0);
 
-            const auto ka = a->Key();
-            const auto kb = b->Key();
+    glGenBuffers(1, &m_quadIndexBuffer);
+    if (!m_arena.initialize(kInitialArenaVertices, m_quadIndexBuffer)) {
+        std::cerr << "Failed to create chunk geometry arena." << std::endl;
+        return false;
+    }
+    return true;
+}
 
-            const int ax = ka.cx * BrickWorlds::Voxel::ChunkX + BrickWorlds::Voxel::ChunkX / 2;
-            const int az = ka.cz * BrickWorlds::Voxel::ChunkZ + BrickWorlds::Voxel::ChunkZ / 2;
-            const int bx = kb.cx * BrickWorlds::Voxel::ChunkX + BrickWorlds::Voxel::ChunkX / 2;
-            const int bz = kb.cz * BrickWorlds::Voxel::ChunkZ + BrickWorlds::Voxel::ChunkZ / 2;
+void Renderer::ensureQuadIndices(std::size_t quads) {
+    if (quads <= m_quadIndexCapacity) return;
 
-            const int da = (ax - camWx) * (ax - camWx) + (az - camWz) * (az - camWz);
-            const int db = (bx - camWx) * (bx - camWx) + (bz - camWz) * (bz - camWz);
+    // Verdoppeln, damit nicht bei jedem etwas groesseren Mesh neu hochgeladen wird
+    std::size_t capacity = std::max<std::size_t>(m_quadIndexCapacity * 2, 4096);
+    while (capacity < quads) capacity *= 2;
 
-            return da < db;
-        });
+    std::vector<std::uint32_t> indices;
+    indices.reserve(capacity * BrickWorlds::Voxel::ChunkMeshData::IndicesPerQuad);
+    for (std::uint32_t q = 0; q < capacity; ++q) {
+        const std::uint32_t base = q * BrickWorlds::Voxel::ChunkMeshData::VerticesPerQuad;
+        indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+    }
 
-    int builtThisFrame = 0;
-    const int maxBuildPerFrame = 6; // <- start: 4..8 fhlt meist gut an
+    // gleicher Buffer-Name: VAOs, die ihn gebunden haben, bleiben gueltig
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_quadIndexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(std::uint32_t), indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    m_quadIndexCapacity = capacity;
+}
 
-    for (auto& ch : chunks) {
-        if (!ch) continue;
+void Renderer::releaseChunkMesh(const BrickWorlds::Voxel::ChunkKey& key) {
+    auto it = m_chunkMeshes.find(key);
+    if (it == m_chunkMeshes.end()) return;
+    // leere Meshes nimmt das Cave-Culling ohnehin als offen
+    if (!it->second.isEmpty()) m_occlusionDirty = true;
+    it->second.release(m_arena);
+    m_chunkMeshes.erase(it);
+}
 
-        const auto st = ch->State();
-        if (st != BrickWorlds::Voxel::ChunkState::ReadyData &&
-            st != BrickWorlds::Voxel::ChunkState::ReadyMesh)
+void Renderer::updateChunkMeshes(BrickWorlds::Voxel::World& world, const BrickWorlds::Voxel::ChunkKey& center) {
+    // Meshes werden auf den Mesh-Workern gebaut; hier nur die fertigen hochladen.
+    // Die Queue bleibt ueber Frames bestehen: Kosten nur fuer neue Ergebnisse und echte Uploads,
+    // neu sortiert wird nur beim Chunk-Wechsel der Kamera.
+    m_uploadQueue.SetCenter(center);
+    world.DrainMeshResults([&](BrickWorlds::Voxel::MeshReady&& ready) {
+        if (ready.unloaded) {
+            m_uploadQueue.Remove(ready.key);
+            releaseChunkMesh(ready.key);
+            return;
+        }
+        m_uploadQueue.Push(ready.key);
+    });
+
+    // Hochladen, bis das Budget erschoepft ist; gemessen wird die CPU-Seite
+    // (glBufferData kopiert in den Treiber), daraus lernt der Scheduler die Kosten pro Byte
+    BrickWorlds::Voxel::ChunkKey key;
+    while (m_uploadQueue.TryPop(key)) {
+        auto ch = world.Chunks().GetChunk(key);
+        if (!ch || ch->State() == BrickWorlds::Voxel::ChunkState::Unloading) {
+            releaseChunkMesh(key);
             continue;
+        }
 
-        if (!ch->ConsumeDirtyMesh())
-            continue;
+        bool deferred = false;
+        ch->ReadMesh([&](const BrickWorlds::Voxel::ChunkMeshData& data) {
+            if (!m_uploadScheduler.canUpload(data.ByteSize())) {
+                deferred = true;
+                return;
+            }
+
+            ChunkMesh& mesh = m_chunkMeshes[key];
+            const bool wasEmpty = mesh.isEmpty();
+            std::uint16_t connectivity[BrickWorlds::Voxel::SectionCount];
+            std::copy(mesh.connectivity(), mesh.connectivity() + BrickWorlds::Voxel::SectionCount, connectivity);
+
+            const auto t0 = std::chrono::steady_clock::now();
+            ensureQuadIndices(data.QuadCount());
+            mesh.upload(data, key, m_arena);
+            const auto t1 = std::chrono::steady_clock::now();
+            m_uploadScheduler.recordUpload(data.ByteSize(), std::chrono::duration<double, std::micro>(t1 - t0).count());
+
+            // Cave-Culling nur neu rechnen, wenn sich der Verbindungsgraph geaendert hat
+            if (wasEmpty != mesh.isEmpty() || (!wasEmpty &&
+                !std::equal(connectivity, connectivity + BrickWorlds::Voxel::SectionCount, mesh.connectivity())))
+                m_occlusionDirty = true;
+        });
 
-        if (builtThisFrame >= maxBuildPerFrame)
+        if (deferred) {
+            // Naechster Frame; Key bleibt im selben Ring
+            m_uploadQueue.Push(key);
+            m_uploadScheduler.recordDeferred();
             break;
-
-        const auto key = ch->Key();
-
-        ChunkMesh* mesh = nullptr;
-        auto it = m_chunkMeshes.find(key);
-        if (it == m_chunkMeshes.end()) {
-            mesh = new ChunkMesh();
-            m_chunkMeshes.emplace(key, mesh);
         }
-        else {
-            mesh = it->second;
-        }
-
-        mesh->generate(world, *ch);
-        ++builtThisFrame;
     }
+    m_uploadScheduler.endFrame(m_uploadQueue.Size());
 }
 
 
-void Renderer::render(const BrickWorlds::Voxel::World& world, const Camera& camera) {
-    updateChunkMeshes(world, camera);
+void Renderer::render(BrickWorlds::Voxel::World& world, const Camera& camera, double lastFrameWorkMs) {
+    auto cp = camera.getPosition();
+    const auto camChunk = BrickWorlds::Voxel::World::WorldToChunk(int(std::floor(cp.x)), int(std::floor(cp.z)));
+
+    m_frameStats = FrameStats{};
+    m_uploadScheduler.beginFrame(lastFrameWorkMs);
+    {
+        BrickWorlds::Core::ScopedTimer timer(BrickWorlds::Core::ProfileStage::UploadMeshes);
+        updateChunkMeshes(world, camChunk);
+    }
 
     glClearColor(0.52f, 0.75f, 0.92f, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -130,33 +197,91 @@ void Renderer::render(const BrickWorlds::Voxel::World& world, const Camera& came
     m_shader.setMat4("uView", view);
     m_shader.setMat4("uProjection", proj);
 
-    // --- Distanz-Culling (sehr gnstig, groer Effekt) ---
-    auto cp = camera.getPosition();
-    const float camX = cp.x;
-    const float camZ = cp.z;
-
-    // Radius in Chunks; sollte grob zu main.cpp UpdateStreaming(..., viewDistanceChunks) passen
-    const int viewDistanceChunks = 6;
+    {
+        BrickWorlds::Core::ScopedTimer timer(BrickWorlds::Core::ProfileStage::CullChunks);
+        cullChunks(cp.x, cp.y, cp.z, camChunk, view, proj);
+    }
+    {
+        BrickWorlds::Core::ScopedTimer timer(BrickWorlds::Core::ProfileStage::DrawSubmit);
+        submitDraws();
+    }
+}
 
-    const float radius = float(viewDistanceChunks * BrickWorlds::Voxel::ChunkX);
+void Renderer::cullChunks(float camX, float camY, float camZ, const BrickWorlds::Voxel::ChunkKey& camChunk,
+    const float* view, const float* proj) {
+    // --- Distanz-Culling (sehr gnstig, groer Effekt) ---
+    // Radius in Chunks; sollte zu main.cpp UpdateStreaming(..., viewDistanceChunks) passen
+    const float radius = float(m_viewDistanceChunks * BrickWorlds::Voxel::ChunkX);
     const float radius2 = radius * radius;
 
+    m_cullBoxes.clear();
+    m_cullCandidates.clear();
+
     for (const auto& kv : m_chunkMeshes) {
-        if (!kv.second) continue;
+        if (kv.second.isEmpty()) continue;
 
         const auto& key = kv.first;
+        const float originX = float(key.cx * BrickWorlds::Voxel::ChunkX);
+        const float originZ = float(key.cz * BrickWorlds::Voxel::ChunkZ);
 
         // Chunk-Mitte in World-Koordinaten
-        const float chunkCenterX = float(key.cx * BrickWorlds::Voxel::ChunkX + BrickWorlds::Voxel::ChunkX * 0.5f);
-        const float chunkCenterZ = float(key.cz * BrickWorlds::Voxel::ChunkZ + BrickWorlds::Voxel::ChunkZ * 0.5f);
-
-        const float dx = chunkCenterX - camX;
-        const float dz = chunkCenterZ - camZ;
+        const float dx = originX + BrickWorlds::Voxel::ChunkX * 0.5f - camX;
+        const float dz = originZ + BrickWorlds::Voxel::ChunkZ * 0.5f - camZ;
 
-        if (dx * dx + dz * dz > radius2)
+        if (dx * dx + dz * dz > radius2) {
+            ++m_frameStats.culledDistance;
             continue;
+        }
 
-        kv.second->render();
+        m_cullBoxes.add({ originX, float(kv.second.minY()), originZ,
+            originX + BrickWorlds::Voxel::ChunkX, float(kv.second.maxY()), originZ + BrickWorlds::Voxel::ChunkZ });
+        m_cullCandidates.emplace_back(key, &kv.second);
+    }
+
+    // --- Frustum-Culling: alle Chunk-Boxen in einem Durchlauf (SSE, 4 Boxen je Ebene) ---
+    const auto frustum = BrickWorlds::Core::Frustum::fromMatrices(proj, view);
+    const std::size_t inFrustum = frustum.cull(m_cullBoxes, m_cullVisible);
+    m_frameStats.culledFrustum = m_cullCandidates.size() - inFrustum;
+
+    // --- Cave-Culling: BFS ueber Sections ab der Kamera, nur durch verbundene Luft ---
+    // Unabhaengig von Blickrichtung und Frustum, daher nur neu bei Wechsel der Kamera-Section,
+    // der Sichtweite oder eines Verbindungsgraphen; sonst gilt das Ergebnis weiter
+    // (bei 24 Chunks Sichtweite kostet ein Durchlauf 1-2 ms).
+    if (m_occlusionCulling) {
+        const int cameraSy = int(std::floor(camY / float(BrickWorlds::Voxel::SectionY)));
+        if (m_occlusionDirty || !(camChunk == m_occlusionChunk) || cameraSy != m_occlusionSy ||
+            m_viewDistanceChunks != m_occlusionRadius) {
+            m_occlusion.Begin(camChunk, m_viewDistanceChunks);
+            for (const auto& kv : m_chunkMeshes) {
+                if (!kv.second.isEmpty()) m_occlusion.SetChunk(kv.first, kv.second.connectivity(), true);
+            }
+            m_occlusion.Traverse(cameraSy);
+            m_occlusionDirty = false;
+            m_occlusionChunk = camChunk;
+            m_occlusionSy = cameraSy;
+            m_occlusionRadius = m_viewDistanceChunks;
+            m_frameStats.sectionsVisited = m_occlusion.VisitedSectionCount();
+        }
     }
 }
 
+void Renderer::submitDraws() {
+    // --- Alle sichtbaren Chunks/Section-Laeufe in einem MultiDraw ---
+    m_draws.clear();
+    for (std::size_t i = 0; i < m_cullCandidates.size(); ++i) {
+        if (!m_cullVisible[i]) continue;
+
+        const auto& key = m_cullCandidates[i].first;
+        const std::uint32_t sections = m_occlusionCulling
+            ? m_occlusion.VisibleSections(key) : BrickWorlds::Voxel::AllSections;
+        if (!sections) {
+            ++m_frameStats.culledOcclusion;
+            continue;
+        }
+
+        m_cullCandidates[i].second->appendDraws(sections, m_arena, m_draws);
+        ++m_frameStats.drawn;
+    }
+    m_frameStats.drawRanges = m_draws.size();
+    m_arena.draw(m_draws);
+}
@@ -3,9 +3,18 @@
 #include "Shader.h"
 #include "Camera.h"
 #include "ChunkMesh.h"
+#include "GeometryArena.h"
+#include <BrickWorlds/Core/Frustum.h>
+#include <BrickWorlds/Core/UploadScheduler.h>
+#include <BrickWorlds/Voxel/DirtyChunkQueue.h>
+#include <BrickWorlds/Voxel/SectionVisibility.h>
 #include <BrickWorlds/Voxel/World.h>
 #include <BrickWorlds/Voxel/ChunkKey.h>
+#include <cstddef>
+#include <cstdint>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 struct ChunkKeyHasher {
     std::size_t operator()(const BrickWorlds::Voxel::ChunkKey& k) const noexcept {
@@ -19,11 +28,70 @@ public:
     ~Renderer();
 
     bool initialize();
-    void render(const BrickWorlds::Voxel::World& world, const Camera& camera);
+    // lastFrameWorkMs: CPU-Zeit des letzten Frames ohne Swap/VSync (0 = unbekannt), steuert das Upload-Budget
+    void render(BrickWorlds::Voxel::World& world, const Camera& camera, double lastFrameWorkMs = 0.0);
+
+    // Sichtweite in Chunks (Distanz-Culling)
+    void setViewDistance(int chunks) { m_viewDistanceChunks = chunks; }
+
+    // Cave-Culling: nur Sections zeichnen, die von der Kamera aus durch Luft erreichbar sind
+    void setOcclusionCulling(bool enabled) { m_occlusionCulling = enabled; }
+
+    // Fertige Meshes werden naechste zuerst hochgeladen, solange Zeit- und Byte-Budget reichen
+    void setUploadBudget(const BrickWorlds::Core::UploadScheduler::Settings& settings) { m_uploadScheduler.setSettings(settings); }
+    const BrickWorlds::Core::UploadScheduler::Stats& uploadStats() const { return m_uploadScheduler.stats(); }
+
+    // Belegung/Fragmentierung des gemeinsamen Vertex-Buffers aller Chunk-Meshes
+    const BrickWorlds::Core::ArenaAllocator::Stats& arenaStats() const { return m_arena.stats(); }
+
+    // Chunk-Meshes des letzten Frames: gezeichnet bzw. per Distanz/Frustum/Verdeckung verworfen
+    struct FrameStats {
+        std::size_t drawn = 0;
+        std::size_t culledDistance = 0;
+        std::size_t culledFrustum = 0;
+        std::size_t culledOcclusion = 0;
+        std::size_t sectionsVisited = 0;   // BFS des Cave-Cullings, 0 = Ergebnis aus dem Vorframe
+        std::size_t drawRanges = 0;        // Eintraege im MultiDraw (ein Draw-Call fuer alle Chunks)
+    };
+    const FrameStats& lastFrameStats() const { return m_frameStats; }
 
 private:
+    static constexpr int kBlockColorCount = 64;   // muss zu uBlockColors im Shader passen
+    static constexpr std::size_t kInitialArenaVertices = std::size_t(1) << 20;   // 8 MB, waechst bei Bedarf
+
     Shader m_shader;
-    std::unordered_map<BrickWorlds::Voxel::ChunkKey, ChunkMesh*, ChunkKeyHasher> m_chunkMeshes;
+    int m_viewDistanceChunks = 6;
+
+    // Gemeinsamer Index-Buffer fuer alle Chunk-Meshes (Quad q: 4q+0,1,2, 4q+0,2,3)
+    unsigned int m_quadIndexBuffer = 0;
+    std::size_t m_quadIndexCapacity = 0;
+    GeometryArena m_arena;
+    // Knoten-basiert: Zeiger auf Meshes bleiben beim Einfuegen gueltig (m_cullCandidates)
+    std::unordered_map<BrickWorlds::Voxel::ChunkKey, ChunkMesh, ChunkKeyHasher> m_chunkMeshes;
+    MultiDrawList m_draws;
+    // Fertige Meshes nach Abstand zur Kamera; mehrere Ergebnisse je Chunk -> ein Upload
+    BrickWorlds::Voxel::DirtyChunkQueue m_uploadQueue;
+    BrickWorlds::Core::UploadScheduler m_uploadScheduler;
+
+    // Culling-Puffer, pro Frame wiederverwendet: Box i gehoert zu m_cullCandidates[i]
+    BrickWorlds::Core::AabbBatch m_cullBoxes;
+    std::vector<std::pair<BrickWorlds::Voxel::ChunkKey, const ChunkMesh*>> m_cullCandidates;
+    std::vector<std::uint8_t> m_cullVisible;
+    BrickWorlds::Voxel::SectionOcclusion m_occlusion;
+    bool m_occlusionCulling = true;
+    // Stand des letzten BFS; dirty, sobald ein Upload/Release einen Verbindungsgraphen aendert
+    bool m_occlusionDirty = true;
+    BrickWorlds::Voxel::ChunkKey m_occlusionChunk;
+    int m_occlusionSy = 0;
+    int m_occlusionRadius = -1;
+    FrameStats m_frameStats;
 
-    void updateChunkMeshes(const BrickWorlds::Voxel::World& world, const Camera& camera);
+    void updateChunkMeshes(BrickWorlds::Voxel::World& world, const BrickWorlds::Voxel::ChunkKey& center);
+    // Distanz-, Frustum- und Cave-Culling -> m_cullCandidates/m_cullVisible/m_occlusion
+    void cullChunks(float camX, float camY, float camZ, const BrickWorlds::Voxel::ChunkKey& camChunk,
+        const float* view, const float* proj);
+    // Sichtbare Section-Laeufe sammeln und in einem MultiDraw zeichnen
+    void submitDraws();
+    void releaseChunkMesh(const BrickWorlds::Voxel::ChunkKey& key);
+    void ensureQuadIndices(std::size_t quads);
 };
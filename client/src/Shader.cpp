@@ -92,6 +92,11 @@ void Shader::setVec3(const char* name, float x, float y, float z) const {
     if (location >= 0) glUniform3f(location, x, y, z);
 }
 
+void Shader::setVec3Array(const char* name, int count, const float* values) const {
+    GLint location = glGetUniformLocation(m_program, name);
+    if (location >= 0) glUniform3fv(location, count, values);
+}
+
 void Shader::setInt(const char* name, int value) const {
     GLint location = glGetUniformLocation(m_program, name);
     if (location >= 0) glUniform1i(location, value);
@@ -14,6 +14,7 @@ public:
 
     void setMat4(const char* name, const float* value) const;
     void setVec3(const char* name, float x, float y, float z) const;
+    void setVec3Array(const char* name, int count, const float* values) const;
     void setInt(const char* name, int value) const;
 
 private:
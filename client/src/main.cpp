@@ -1,15 +1,23 @@
 #include <BrickWorlds/Version.h>
+#include <BrickWorlds/Core/Profiler.h>
 #include <BrickWorlds/Voxel/World.h>
 #include <BrickWorlds/Voxel/FlatGenerator.h>
 #include <BrickWorlds/Voxel/BlockId.h>
 #include "Camera.h"
 #include "Renderer.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
 using namespace BrickWorlds::Voxel;
 
+// Sichtweite in Chunks; ab kLodStartChunks werden entfernte Chunks als LOD-Mesh gebaut
+static constexpr int kViewDistanceChunks = 24;
+static constexpr int kLodStartChunks = 6;
+
 struct InputState {
     bool keys[512] = { false };
     double lastMouseX = 640.0;
@@ -88,6 +96,17 @@ void processInput(Camera& camera, float deltaTime) {
 
 
 int main(int argc, char* argv[]) {
+    // --profile <datei>: Stage-Zeiten messen, beim Beenden p50/p95/p99 als JSON schreiben (- = stdout)
+    const char* profilePath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) profilePath = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--profile <file>|-]\n", argv[0]);
+            return 2;
+        }
+    }
+    BrickWorlds::Core::Profiler::setEnabled(profilePath != nullptr);
+
     std::cout << "BrickWorlds Client v" << BrickWorlds::Version::GetVersionString() << std::endl;
     std::cout << "Initializing 3D rendering system..." << std::endl;
 
@@ -129,13 +148,15 @@ int main(int argc, char* argv[]) {
     FlatGenerator generator;
     World world(&generator);
 
-    // 1 Gen-Thread, 1 Mesh-Thread (Mesh ist zunächst Stub/CPU-Mesh, je nachdem wie du es umgesetzt hast)
-    world.StartStreaming(1, 1);
+    // Gemeinsamer Work-Stealing-Pool fuer Generate + Mesh (hardware_concurrency Worker)
+    world.SetLodDistance(kLodStartChunks);
+    world.StartStreaming();
 
     std::cout << "Starting chunk streaming..." << std::endl;
 
 
     Renderer renderer;
+    renderer.setViewDistance(kViewDistanceChunks);
     if (!renderer.initialize()) {
         std::cerr << "Failed to initialize renderer!" << std::endl;
         glfwTerminate();
@@ -200,6 +221,10 @@ int main(int argc, char* argv[]) {
         });
 
     double lastTime = glfwGetTime();
+    double statsTime = lastTime;
+    int frames = 0;
+    double lastWorkMs = 0.0;   // CPU-Zeit des letzten Frames ohne Swap (Upload-Budget)
+
 
     while (!glfwWindowShouldClose(window)) {
         double currentTime = glfwGetTime();
@@ -211,10 +236,33 @@ int main(int argc, char* argv[]) {
         int playerWx = static_cast<int>(pos.x);
         int playerWz = static_cast<int>(pos.z);
 
-        // viewDistanceChunks: erstmal klein starten (z.B. 4-6)
-        world.UpdateStreaming(playerWx, playerWz, 6);
+        world.UpdateStreaming(playerWx, playerWz, kViewDistanceChunks);
+
+        renderer.render(world, camera, lastWorkMs);
+
+        // Einmal pro Sekunde: FPS und Culling-Zaehler des letzten Frames im Fenstertitel
+        ++frames;
+        if (currentTime - statsTime >= 1.0) {
+            const Renderer::FrameStats& stats = renderer.lastFrameStats();
+            const auto& uploads = renderer.uploadStats();
+            const auto& arena = renderer.arenaStats();
+            char title[384];
+            std::snprintf(title, sizeof(title), "BrickWorlds - %d FPS - chunks drawn %zu in %zu ranges, culled %zu (frustum %zu, distance %zu, occlusion %zu)"
+                " - uploads %zu (%.0f/%.0f us), backlog %zu - arena %.1f/%.1f MB, frag %.2f",
+                frames, stats.drawn, stats.drawRanges, stats.culledFrustum + stats.culledDistance + stats.culledOcclusion,
+                stats.culledFrustum, stats.culledDistance, stats.culledOcclusion,
+                uploads.uploads, uploads.spentUs, uploads.budgetUs, uploads.backlog,
+                arena.used * 8.0 / (1024.0 * 1024.0), arena.capacity * 8.0 / (1024.0 * 1024.0), arena.fragmentation());
+            glfwSetWindowTitle(window, title);
+            frames = 0;
+            statsTime = currentTime;
+        }
+        lastWorkMs = (glfwGetTime() - currentTime) * 1000.0;
+        if (BrickWorlds::Core::Profiler::enabled()) {
+            BrickWorlds::Core::Profiler::record(BrickWorlds::Core::ProfileStage::Frame,
+                static_cast<std::uint64_t>(lastWorkMs * 1e6));
+        }
 
-        renderer.render(world, camera);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
@@ -227,6 +275,20 @@ int main(int argc, char* argv[]) {
     glfwDestroyWindow(window);
     glfwTerminate();
 
+    if (profilePath) {
+        std::cout << "\nProfile (latest " << BrickWorlds::Core::Profiler::RingSize << " samples per thread and stage):" << std::endl;
+        BrickWorlds::Core::Profiler::printReport(stdout);
+        const bool toStdout = std::strcmp(profilePath, "-") == 0;
+        std::FILE* f = toStdout ? stdout : std::fopen(profilePath, "w");
+        if (f) {
+            BrickWorlds::Core::Profiler::writeJson(f);
+            if (!toStdout) std::fclose(f);
+        }
+        else {
+            std::cerr << "cannot write " << profilePath << std::endl;
+        }
+    }
+
     std::cout << "\nShutdown complete." << std::endl;
     return 0;
 }
@@ -1,12 +1,26 @@
 #include <BrickWorlds/Version.h>
+#include <BrickWorlds/Core/Profiler.h>
 #include <BrickWorlds/Voxel/World.h>
 #include <BrickWorlds/Voxel/FlatGenerator.h>
 
 #include <chrono>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <thread>
 
 int main(int argc, char* argv[]) {
+    // --profile <datei>: Tick- und Job-Zeiten messen, beim Beenden p50/p95/p99 als JSON schreiben (- = stdout)
+    const char* profilePath = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--profile") == 0 && i + 1 < argc) profilePath = argv[++i];
+        else {
+            std::fprintf(stderr, "usage: %s [--profile <file>|-]\n", argv[0]);
+            return 2;
+        }
+    }
+    BrickWorlds::Core::Profiler::setEnabled(profilePath != nullptr);
+
     std::cout << "BrickWorlds Server v" << BrickWorlds::Version::GetVersionString() << std::endl;
     std::cout << "Starting server..." << std::endl;
 
@@ -14,25 +28,50 @@ int main(int argc, char* argv[]) {
 
     FlatGenerator generator;
     World world(&generator);
+    // Kein Renderer: Meshes und MeshReady-Ergebnisse wuerden nie abgeholt
+    world.SetMeshingEnabled(false);
 
-    // 1 Gen-Thread, 1 Mesh-Thread (Mesh ist aktuell noch Stub  passt)
-    world.StartStreaming(1, 1);
+    // Gemeinsamer Work-Stealing-Pool fuer Generate (hardware_concurrency Worker)
+    world.StartStreaming();
 
     int playerWx = 0;
     int playerWz = 0;
     const int viewDistanceChunks = 6;
 
     for (int tick = 0; tick < 300; ++tick) {
-        world.UpdateStreaming(playerWx, playerWz, viewDistanceChunks);
+        {
+            BrickWorlds::Core::ScopedTimer timer(BrickWorlds::Core::ProfileStage::ServerTick);
+            world.UpdateStreaming(playerWx, playerWz, viewDistanceChunks);
 
-        // Debug: Anzahl geladener Chunks
-        auto all = world.Chunks().SnapshotAll();
-        std::cout << "Tick " << tick << " | loaded chunks: " << all.size() << std::endl;
+            // Debug: Anzahl geladener Chunks
+            auto all = world.Chunks().SnapshotAll();
+            std::cout << "Tick " << tick << " | loaded chunks: " << all.size() << std::endl;
+        }
 
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
 
+    const auto stats = world.StreamStats();
+    std::cout << "Streaming: " << stats.scheduler.workers << " workers, "
+        << stats.generate.completed << " generated (" << stats.generate.Throughput() << "/s, "
+        << stats.generate.cancelled << " cancelled), "
+        << stats.mesh.completed << " meshed, " << stats.scheduler.stolen << " steals" << std::endl;
+
     world.StopStreaming();
+
+    if (profilePath) {
+        std::cout << "Profile (latest " << BrickWorlds::Core::Profiler::RingSize << " samples per thread and stage):" << std::endl;
+        BrickWorlds::Core::Profiler::printReport(stdout);
+        const bool toStdout = std::strcmp(profilePath, "-") == 0;
+        std::FILE* f = toStdout ? stdout : std::fopen(profilePath, "w");
+        if (f) {
+            BrickWorlds::Core::Profiler::writeJson(f);
+            if (!toStdout) std::fclose(f);
+        }
+        else {
+            std::cerr << "cannot write " << profilePath << std::endl;
+        }
+    }
     std::cout << "Server shutdown." << std::endl;
     return 0;
 }
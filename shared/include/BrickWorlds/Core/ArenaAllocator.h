@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace BrickWorlds {
+namespace Core {
+
+// CPU-side sub-allocator for one large GPU buffer (units are up to the caller, e.g. vertices).
+// Best-fit free list with coalescing of neighbouring free blocks. Allocations are addressed
+// by handle, so compaction can move them without the owners noticing.
+// GL-free: the buffer copies for grow/compact are done by the caller.
+class ArenaAllocator {
+public:
+    using Handle = std::uint32_t;
+    static constexpr Handle InvalidHandle = ~Handle(0);
+
+    struct Stats {
+        std::size_t capacity = 0;
+        std::size_t used = 0;
+        std::size_t freeBlocks = 0;
+        std::size_t largestFree = 0;
+        std::size_t allocations = 0;        // live
+        std::size_t failedAllocations = 0;  // no free block large enough
+        std::size_t compactions = 0;
+        std::size_t movedUnits = 0;         // by all compactions
+
+        // 0 = all free space in one block, -> 1 = free space scattered in small blocks
+        double fragmentation() const {
+            const std::size_t free = capacity - used;
+            return free ? 1.0 - double(largestFree) / double(free) : 0.0;
+        }
+    };
+
+    explicit ArenaAllocator(std::size_t capacity = 0);
+
+    // InvalidHandle if no free block is large enough (grow or compact, then retry)
+    Handle allocate(std::size_t size);
+    void release(Handle handle);
+
+    std::size_t offset(Handle handle) const { return m_blocks[handle].offset; }
+    std::size_t size(Handle handle) const { return m_blocks[handle].size; }
+
+    // Appends free space at the end (the caller has copied the buffer)
+    void grow(std::size_t newCapacity);
+
+    // Packs all allocations to the front in offset order, so the free space is one block.
+    // move(handle, fromOffset, toOffset, size) is called for every live allocation in that
+    // order, also for those that stay (copying into a fresh buffer needs all of them).
+    template <typename Move>
+    void compact(Move&& move);
+
+    std::size_t capacity() const { return m_capacity; }
+    std::size_t freeSpace() const { return m_capacity - m_stats.used; }
+    const Stats& stats() const;
+
+private:
+    struct Block {
+        std::size_t offset = 0;
+        std::size_t size = 0;
+        bool live = false;
+    };
+
+    void insertFree(std::size_t offset, std::size_t size);
+    void eraseFree(std::map<std::size_t, std::size_t>::iterator it);
+
+    std::size_t m_capacity = 0;
+    std::vector<Block> m_blocks;        // indexed by handle
+    std::vector<Handle> m_freeHandles;
+    std::map<std::size_t, std::size_t> m_freeByOffset;               // offset -> size
+    std::set<std::pair<std::size_t, std::size_t>> m_freeBySize;      // (size, offset)
+    mutable Stats m_stats;
+};
+
+template <typename Move>
+void ArenaAllocator::compact(Move&& move) {
+    std::vector<std::pair<std::size_t, Handle>> live;
+    live.reserve(m_stats.allocations);
+    for (Handle h = 0; h < m_blocks.size(); ++h)
+        if (m_blocks[h].live) live.emplace_back(m_blocks[h].offset, h);
+    std::sort(live.begin(), live.end());
+
+    std::size_t next = 0;
+    for (const auto& entry : live) {
+        Block& b = m_blocks[entry.second];
+        move(entry.second, b.offset, next, b.size);
+        if (b.offset != next) m_stats.movedUnits += b.size;
+        b.offset = next;
+        next += b.size;
+    }
+
+    m_freeByOffset.clear();
+    m_freeBySize.clear();
+    if (next < m_capacity) insertFree(next, m_capacity - next);
+    ++m_stats.compactions;
+}
+
+} // namespace Core
+} // namespace BrickWorlds
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BrickWorlds {
+namespace Core {
+
+// Axis-aligned bounding box in world coordinates
+struct Aabb {
+    float minX, minY, minZ;
+    float maxX, maxY, maxZ;
+};
+
+// Many boxes as structure-of-arrays, so the plane test checks 4 boxes per SSE instruction
+class AabbBatch {
+public:
+    void clear();
+    void add(const Aabb& box);
+    void reserve(std::size_t count);
+
+    std::size_t size() const { return m_minX.size(); }
+
+private:
+    friend class Frustum;
+
+    std::vector<float> m_minX, m_minY, m_minZ;
+    std::vector<float> m_maxX, m_maxY, m_maxZ;
+};
+
+// View frustum from projection * view (OpenGL convention, column-major like
+// Camera::getViewMatrix/getProjectionMatrix). GL-free so culling can be tested
+// and measured headless.
+class Frustum {
+public:
+    // a*x + b*y + c*z + d >= 0 means inside
+    struct Plane {
+        float a, b, c, d;
+    };
+
+    enum PlaneIndex { Left = 0, Right, Bottom, Top, Near, Far, PlaneCount };
+
+    static Frustum fromMatrices(const float* projection, const float* view);
+    static Frustum fromViewProjection(const float* viewProjection);
+
+    // Box completely behind one plane -> invisible. Conservative: boxes near the
+    // frustum corners may pass although they are outside.
+    bool intersects(const Aabb& box) const;
+
+    // visible[i] = 1 for every visible box, returns the number of visible boxes
+    std::size_t cull(const AabbBatch& boxes, std::vector<std::uint8_t>& visible) const;
+
+    const Plane& plane(int i) const { return m_planes[i]; }
+
+    // "sse" or "scalar"
+    static const char* cullKernelName();
+
+private:
+    Plane m_planes[PlaneCount];
+};
+
+} // namespace Core
+} // namespace BrickWorlds
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace BrickWorlds {
+namespace Core {
+
+// Measured stages; fixed enum so recording is an array index, no string lookup
+enum class ProfileStage : std::uint8_t {
+    Frame = 0,          // client: CPU work per frame without swap/vsync
+    UpdateStreaming,
+    UploadMeshes,
+    CullChunks,
+    DrawSubmit,
+    ServerTick,
+    GenerateChunk,      // worker job
+    MeshChunk,          // worker job
+    Count
+};
+
+const char* profileStageName(ProfileStage stage);
+
+struct ProfileStageReport {
+    ProfileStage stage = ProfileStage::Frame;
+    std::size_t samples = 0;
+    double meanUs = 0.0;
+    double p50Us = 0.0;
+    double p95Us = 0.0;
+    double p99Us = 0.0;
+    double maxUs = 0.0;
+};
+
+// Per-thread ring buffers with the latest RingSize samples per stage. Recording is lock-free
+// (thread-local ring, relaxed atomics); the registry mutex is only taken when a thread records
+// for the first time and when a report is built. Disabled by default: ScopedTimer then does
+// not even read the clock.
+class Profiler {
+public:
+    static constexpr std::size_t RingSize = 4096;
+
+    static void setEnabled(bool enabled) { s_enabled.store(enabled, std::memory_order_relaxed); }
+    static bool enabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    static void record(ProfileStage stage, std::uint64_t nanoseconds);
+
+    // One entry per stage with samples, percentiles over the retained samples of all threads
+    static std::vector<ProfileStageReport> report();
+
+    static void printReport(std::FILE* out);
+    static void writeJson(std::FILE* out);
+
+private:
+    static inline std::atomic<bool> s_enabled{ false };
+};
+
+// Times the enclosing scope into a stage
+class ScopedTimer {
+public:
+    explicit ScopedTimer(ProfileStage stage)
+        : m_stage(stage), m_active(Profiler::enabled()) {
+        if (m_active) m_start = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedTimer() {
+        if (!m_active) return;
+        const auto elapsed = std::chrono::steady_clock::now() - m_start;
+        Profiler::record(m_stage, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    ProfileStage m_stage;
+    bool m_active;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace Core
+} // namespace BrickWorlds
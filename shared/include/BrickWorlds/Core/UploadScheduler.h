@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+
+namespace BrickWorlds {
+namespace Core {
+
+// Per-frame budget for work that has to run on the render thread (mesh uploads).
+// The time budget follows the measured frame work time towards a target, the cost of a
+// single upload is predicted from the measured costs so far (time = overhead + bytes * rate).
+// GL-free so the controller can be driven and measured headless.
+class UploadScheduler {
+public:
+    struct Settings {
+        double targetFrameMs = 12.0;      // CPU work per frame without swap/vsync wait
+        double minBudgetUs = 250.0;       // never starve completely
+        double maxBudgetUs = 6000.0;
+        double initialBudgetUs = 1000.0;
+        std::size_t maxBytesPerFrame = 8u << 20;   // bus/driver limit independent of time
+    };
+
+    struct Stats {
+        double budgetUs = 0.0;            // time budget of the current frame
+        double spentUs = 0.0;             // measured upload time of the current frame
+        std::size_t bytes = 0;
+        std::size_t uploads = 0;
+        std::size_t deferred = 0;         // uploads refused by the budget this frame
+        std::size_t backlog = 0;          // waiting uploads at endFrame
+        double lastFrameMs = 0.0;
+        double overheadUs = 0.0;          // cost model: per upload
+        double nsPerByte = 0.0;           // cost model: per byte
+    };
+
+    UploadScheduler();
+    explicit UploadScheduler(const Settings& settings);
+
+    void setSettings(const Settings& settings);
+    const Settings& settings() const { return m_settings; }
+
+    // Start of a frame: adapt the budget to the work time of the previous frame
+    // (<= 0: unknown, keep the budget)
+    void beginFrame(double lastFrameWorkMs);
+
+    // True if an upload of this size fits into the remaining budget. The first upload of
+    // a frame always fits, so huge meshes cannot block the queue.
+    bool canUpload(std::size_t bytes) const;
+    // Predicted cost of an upload of this size
+    double estimateUs(std::size_t bytes) const;
+
+    // Measured cost of an upload that was done
+    void recordUpload(std::size_t bytes, double microseconds);
+    void recordDeferred() { ++m_stats.deferred; }
+
+    void endFrame(std::size_t backlog) { m_stats.backlog = backlog; }
+
+    const Stats& stats() const { return m_stats; }
+
+private:
+    Settings m_settings;
+    Stats m_stats;
+    double m_budgetUs = 0.0;
+
+    // Linear regression time(bytes) with exponential forgetting (sums weighted by kDecay^age)
+    double m_sumW = 0.0, m_sumX = 0.0, m_sumY = 0.0, m_sumXX = 0.0, m_sumXY = 0.0;
+};
+
+} // namespace Core
+} // namespace BrickWorlds
@@ -19,6 +19,11 @@ namespace BrickWorlds::Voxel {
 
     inline constexpr int ChunkVolume = ChunkX * ChunkY * ChunkZ;
 
+    // Vertikale 16er-Sections (16x16x16)
+    inline constexpr int SectionY = 16;
+    inline constexpr int SectionCount = ChunkY / SectionY;
+    inline constexpr int SectionVolume = ChunkX * SectionY * ChunkZ;
+
     inline constexpr int Index(int lx, int ly, int lz) {
         // (ly * Z + lz) * X + lx
         return (ly * ChunkZ + lz) * ChunkX + lx;
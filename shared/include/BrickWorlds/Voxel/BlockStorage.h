@@ -0,0 +1,62 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "BlockId.h"
+
+namespace BrickWorlds::Voxel {
+
+    // Palette-komprimierter Block-Speicher.
+    // Jeder Voxel speichert nur einen Index in die Palette (1/2/4/8 Bit pro Voxel),
+    // die Bitbreite waechst bei Bedarf. Ab mehr als 256 Ids wird direkt mit 16 Bit
+    // gespeichert (Palette leer).
+    class BlockStorage {
+    public:
+        explicit BlockStorage(int size, BlockId fill = Air);
+
+        int Size() const { return size_; }
+        int BitsPerBlock() const { return bits_; }
+        std::size_t PaletteSize() const { return palette_.size(); }
+
+        BlockId Get(int index) const {
+            const std::uint32_t raw = ReadRaw(index);
+            return (bits_ == 16) ? static_cast<BlockId>(raw) : palette_[raw];
+        }
+
+        // count Ids ab index am Stueck dekodieren (Wort fuer Wort statt count x Get)
+        void GetRange(int index, int count, BlockId* out) const;
+
+        void Set(int index, BlockId id);
+
+        // Alle Voxel auf eine Id setzen (Palette + Bitbreite werden zurueckgesetzt)
+        void Fill(BlockId id);
+
+        // Unbenutzte Palette-Eintraege entfernen und Bitbreite minimieren
+        // (z.B. nach der Generierung aufrufen)
+        void Compact();
+
+        // Belegter Heap + Objektgroesse in Bytes
+        std::size_t MemoryUsage() const;
+
+    private:
+        std::uint32_t ReadRaw(int index) const {
+            const int perWord = 64 / bits_;
+            const std::uint64_t word = words_[static_cast<std::size_t>(index / perWord)];
+            const int shift = (index % perWord) * bits_;
+            return static_cast<std::uint32_t>((word >> shift) & ((1ull << bits_) - 1));
+        }
+
+        void WriteRaw(int index, std::uint32_t value);
+        std::uint32_t PaletteIndexOf(BlockId id);
+        void Repack(int newBits, const std::vector<std::uint16_t>& remap);
+
+        static int BitsForPalette(std::size_t paletteSize);
+
+        int size_ = 0;
+        int bits_ = 1;
+        std::vector<BlockId> palette_;
+        std::vector<std::uint64_t> words_;
+    };
+
+} // namespace BrickWorlds::Voxel
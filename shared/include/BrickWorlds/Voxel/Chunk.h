@@ -1,11 +1,16 @@
 #pragma once
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 
 #include "BlockId.h"
+#include "ChunkBlocks.h"
 #include "ChunkKey.h"
+#include "PackedVertex.h"
+#include "SectionVisibility.h"
 
 namespace BrickWorlds::Voxel {
 
@@ -18,12 +23,129 @@ namespace BrickWorlds::Voxel {
         Unloading
     };
 
+    // Mesh-Bucket = (Section, Seite). Quads liegen nach Bucket sortiert im Mesh und
+    // reichen nie ueber eine Section hinaus, daher laesst sich jeder Bucket einzeln ersetzen.
+    inline constexpr int MeshBucketCount = SectionCount * MeshFaceCount;
+
+    inline constexpr int MeshBucket(int sy, int face) { return sy * MeshFaceCount + face; }
+
+    // Ein Dirty-Bit pro Mesh-Bucket
+    struct MeshDirtyMask {
+        static constexpr int Words = (MeshBucketCount + 63) / 64;
+        static constexpr int AllFaces = (1 << MeshFaceCount) - 1;
+
+        std::uint64_t w[Words] = {};
+
+        static MeshDirtyMask All() {
+            MeshDirtyMask m;
+            m.AddSections(0, SectionCount - 1, AllFaces);
+            return m;
+        }
+
+        // Block-Edits in den Zeilen ly0..ly1: deren Sections komplett, dazu die
+        // angrenzende Seite der Section darueber/darunter, wenn der Bereich an der Grenze liegt
+        static MeshDirtyMask ForRows(int ly0, int ly1) {
+            MeshDirtyMask m;
+            const int sy0 = ly0 / SectionY;
+            const int sy1 = ly1 / SectionY;
+            m.AddSections(sy0, sy1, AllFaces);
+            if (ly0 % SectionY == 0 && sy0 > 0) m.Add(sy0 - 1, FacePlusY);
+            if (ly1 % SectionY == SectionY - 1 && sy1 + 1 < SectionCount) m.Add(sy1 + 1, FaceMinusY);
+            return m;
+        }
+
+        void Add(int sy, int face) {
+            const int b = MeshBucket(sy, face);
+            w[b >> 6] |= std::uint64_t{ 1 } << (b & 63);
+        }
+
+        // faceBits: Bit f = Seite f
+        void AddSections(int sy0, int sy1, int faceBits) {
+            for (int sy = sy0; sy <= sy1; ++sy)
+                for (int f = 0; f < MeshFaceCount; ++f)
+                    if (faceBits & (1 << f)) Add(sy, f);
+        }
+
+        bool Test(int bucket) const { return (w[bucket >> 6] >> (bucket & 63)) & 1u; }
+
+        bool Any() const {
+            for (std::uint64_t x : w) if (x) return true;
+            return false;
+        }
+
+        bool IsAll() const {
+            const MeshDirtyMask all = All();
+            for (int i = 0; i < Words; ++i) if (w[i] != all.w[i]) return false;
+            return true;
+        }
+
+        // Sections mit mindestens einem Dirty-Bucket (Bit sy)
+        std::uint32_t Sections() const {
+            std::uint32_t s = 0;
+            for (int sy = 0; sy < SectionCount; ++sy)
+                for (int f = 0; f < MeshFaceCount; ++f)
+                    if (Test(MeshBucket(sy, f))) { s |= 1u << sy; break; }
+            return s;
+        }
+
+        MeshDirtyMask& operator|=(const MeshDirtyMask& o) {
+            for (int i = 0; i < Words; ++i) w[i] |= o.w[i];
+            return *this;
+        }
+    };
+
+    // CPU-Mesh eines Chunks (vom ChunkMesher erzeugt, GL-frei).
+    // Je 4 PackedVertex bilden ein Quad (Ecken 0-1-2, 0-2-3); Indizes kommen aus
+    // einem gemeinsamen Quad-Index-Buffer des Renderers.
     struct ChunkMeshData {
-        // Placeholder: spter ersetzen durch echte Vertex-Structs / GPU-Handles
-        std::vector<float> vertices;
-        std::vector<std::uint32_t> indices;
+        static constexpr int VerticesPerQuad = 4;
+        static constexpr int IndicesPerQuad = 6;
+
+        std::vector<PackedVertex> vertices;
+        // Erster Vertex jedes Buckets; bucketStart[MeshBucketCount] = vertices.size()
+        std::uint32_t bucketStart[MeshBucketCount + 1] = {};
+        // Verbindungsgraph pro Section fuer das Cave-Culling des Renderers
+        std::uint16_t connectivity[SectionCount];
+
+        ChunkMeshData() { Clear(); }
+
+        void Clear() {
+            vertices.clear();
+            for (auto& b : bucketStart) b = 0;
+            for (auto& c : connectivity) c = AllFacesConnected;
+        }
+        bool Empty() const { return vertices.empty(); }
+        std::size_t VertexCount() const { return vertices.size(); }
+        std::size_t QuadCount() const { return vertices.size() / VerticesPerQuad; }
+        std::size_t ByteSize() const { return vertices.size() * sizeof(PackedVertex); }
+    };
 
-        void Clear() { vertices.clear(); indices.clear(); }
+    // Unveraenderlicher Schnappschuss der Block-Daten eines Chunks.
+    // Lesen ist ohne Locks moeglich; spaetere Schreibzugriffe auf den Chunk
+    // veroeffentlichen einen neuen Schnappschuss und lassen diesen unberuehrt.
+    class ChunkReadView {
+    public:
+        ChunkReadView() = default;
+        explicit ChunkReadView(std::shared_ptr<const ChunkBlocks> blocks)
+            : blocks_(std::move(blocks)) {
+        }
+
+        explicit operator bool() const { return blocks_ != nullptr; }
+
+        BlockId Get(int lx, int ly, int lz) const { return blocks_->Get(Index(lx, ly, lz)); }
+
+        bool IsSectionUniform(int sy) const { return blocks_->IsSectionUniform(sy); }
+        BlockId SectionId(int sy) const { return blocks_->SectionId(sy); }
+
+        // Hoehenkarte und belegter Y-Bereich (siehe ChunkBlocks)
+        int Height(int lx, int lz) const { return blocks_->Height(lx, lz); }
+        int MinY() const { return blocks_->MinY(); }
+        int MaxY() const { return blocks_->MaxY(); }
+
+        const ChunkBlocks& Blocks() const { return *blocks_; }
+
+    private:
+        std::shared_ptr<const ChunkBlocks> blocks_;
     };
 
     class Chunk {
@@ -32,35 +154,113 @@ namespace BrickWorlds::Voxel {
 
         const ChunkKey& Key() const { return key_; }
 
+        // Fuer Wiederverwendung aus dem ChunkManager-Pool: neuer Key, State Empty,
+        // alle Blocks Air. Block- und Mesh-Puffer behalten ihre Kapazitaet.
+        // Nur aufrufen, wenn kein anderer Thread den Chunk referenziert.
+        void Reset(ChunkKey key);
+
         ChunkState State() const { return state_.load(std::memory_order_relaxed); }
         void SetState(ChunkState s) { state_.store(s, std::memory_order_relaxed); }
+        // Atomarer Uebergang from -> to; false, wenn der State inzwischen ein anderer ist
+        bool TransitionState(ChunkState from, ChunkState to) {
+            return state_.compare_exchange_strong(from, to, std::memory_order_acq_rel, std::memory_order_relaxed);
+        }
+
+        // Lesen ohne Chunk-Mutex ueber den zuletzt veroeffentlichten Schnappschuss.
+        // Fuer viele Zugriffe (Mesher, Raycasts, Serialisierung) einmal View() holen.
+        ChunkReadView View() const { return ChunkReadView(std::atomic_load(&published_)); }
 
-        // Simple thread-safe access (spter optimierbar)
         BlockId Get(int lx, int ly, int lz) const;
         void Set(int lx, int ly, int lz, BlockId id);
 
+        // Oberster Nicht-Air-Block der Spalte, -1 = leer (Hoehenkarte, O(1))
+        int Height(int lx, int lz) const;
+
+        // Mehrere Schreibzugriffe unter einem Lock und mit einem einzigen Publish.
+        // fn(ChunkBlocks&) liefert true, wenn sich etwas geaendert hat.
+        // Die betroffenen Mesh-Buckets markiert der Aufrufer (MarkDirtyMesh).
+        template <typename Fn>
+        bool Edit(Fn&& fn) {
+            std::scoped_lock lk(mtx_);
+            if (!fn(blocks_)) return false;
+            PublishUnsafe();
+            dirtyBlocks_.store(true, std::memory_order_relaxed);
+            return true;
+        }
+
         // Fr Generator/Mesher: extern synchronisieren ber Mutex()
-        std::vector<BlockId>& BlocksUnsafe() { return blocks_; }
-        const std::vector<BlockId>& BlocksUnsafe() const { return blocks_; }
+        // Zugriff per Index(lx, ly, lz) ueber Get()/Set()
+        // nderungen werden erst nach PublishUnsafe() fr View()-Leser sichtbar.
+        ChunkBlocks& BlocksUnsafe() { return blocks_; }
+        const ChunkBlocks& BlocksUnsafe() const { return blocks_; }
+        void PublishUnsafe();
+
+        // Section-Abfragen (O(1)), z.B. um leere/solide Sections zu ueberspringen
+        bool IsSectionUniform(int sy) const;
+        BlockId SectionId(int sy) const;
 
         bool ConsumeDirtyBlocks() { return dirtyBlocks_.exchange(false, std::memory_order_relaxed); }
-        void MarkDirtyMesh() { dirtyMesh_.store(true, std::memory_order_relaxed); }
-        bool ConsumeDirtyMesh() { return dirtyMesh_.exchange(false, std::memory_order_relaxed); }
+        // Dirty-Buckets fuer das naechste (inkrementelle) Meshing; ohne Argument alles
+        void MarkDirtyMesh() { MarkDirtyMesh(MeshDirtyMask::All()); }
+        void MarkDirtyMesh(const MeshDirtyMask& mask) {
+            for (int i = 0; i < MeshDirtyMask::Words; ++i) dirtyMesh_[i].fetch_or(mask.w[i], std::memory_order_relaxed);
+        }
+        MeshDirtyMask ConsumeDirtyMesh() {
+            MeshDirtyMask m;
+            for (int i = 0; i < MeshDirtyMask::Words; ++i) m.w[i] = dirtyMesh_[i].exchange(0, std::memory_order_relaxed);
+            return m;
+        }
+        bool IsMeshDirty() const {
+            for (const auto& w : dirtyMesh_) if (w.load(std::memory_order_relaxed)) return true;
+            return false;
+        }
+
+        // Detailstufe des Meshes (0 = volle Aufloesung), von World nach Entfernung gesetzt
+        int Lod() const { return lod_.load(std::memory_order_relaxed); }
+        void SetLod(int lod) { lod_.store(static_cast<std::uint8_t>(lod), std::memory_order_relaxed); }
 
-        ChunkMeshData& Mesh() { return mesh_; }
-        const ChunkMeshData& Mesh() const { return mesh_; }
+        // Beim letzten Meshen fehlende Nachbarn (Neighbor*-Bits aus PaddedChunk.h).
+        // Wer ein Bit per ClearMissingNeighbor loescht, stoesst genau einen Remesh an.
+        std::uint8_t MissingNeighbors() const { return missingNeighbors_.load(std::memory_order_acquire); }
+        void SetMissingNeighbors(std::uint8_t bits) { missingNeighbors_.store(bits, std::memory_order_seq_cst); }
+        bool ClearMissingNeighbor(std::uint8_t bit) {
+            return (missingNeighbors_.fetch_and(static_cast<std::uint8_t>(~bit), std::memory_order_seq_cst) & bit) != 0;
+        }
+
+        // Mesh-Worker tauscht ein fertiges Mesh ein; mesh enthaelt danach die alten Puffer
+        // (Kapazitaet wandert zurueck zum Worker).
+        void SwapMesh(ChunkMeshData& mesh);
+
+        // Renderer liest das aktuelle Mesh unter dem Mesh-Mutex: fn(const ChunkMeshData&)
+        template <typename Fn>
+        void ReadMesh(Fn&& fn) const {
+            std::scoped_lock lk(meshMtx_);
+            fn(static_cast<const ChunkMeshData&>(mesh_));
+        }
+
+        // Aktuelles Mesh ohne Lock und ohne Kopie, nur fuer den laufenden Mesh-Job: er ist der
+        // einzige Schreiber (SwapMesh, State Meshing schliesst einen zweiten Job aus), andere
+        // Threads lesen unter dem Mesh-Mutex nur mit. Gueltig bis zum naechsten SwapMesh.
+        const ChunkMeshData& MeshForRemesh() const { return mesh_; }
 
         std::mutex& Mutex() { return mtx_; }
 
+        // Geschaetzter Speicherverbrauch (Chunk + Block-Speicher + Mesh-Puffer)
+        std::size_t MemoryUsage() const;
+
     private:
         ChunkKey key_;
         mutable std::mutex mtx_;
-        std::vector<BlockId> blocks_;
+        ChunkBlocks blocks_;                              // Arbeitskopie der Schreiber (unter mtx_)
+        std::shared_ptr<const ChunkBlocks> published_;    // Schnappschuss fuer Leser (atomic_load/store)
+        mutable std::mutex meshMtx_;                      // schuetzt mesh_
         ChunkMeshData mesh_;
 
         std::atomic<ChunkState> state_{ ChunkState::Empty };
         std::atomic<bool> dirtyBlocks_{ true }; // initial: needs mesh after generate
-        std::atomic<bool> dirtyMesh_{ true };
+        std::atomic<std::uint64_t> dirtyMesh_[MeshDirtyMask::Words] = {};
+        std::atomic<std::uint8_t> missingNeighbors_{ 0 };
+        std::atomic<std::uint8_t> lod_{ 0 };
     };
 
 } // namespace BrickWorlds::Voxel
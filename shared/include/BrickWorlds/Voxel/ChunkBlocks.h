@@ -0,0 +1,106 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "BlockId.h"
+#include "BlockStorage.h"
+
+namespace BrickWorlds::Voxel {
+
+    // Block-Daten einer Chunk-Saeule, aufgeteilt in SectionCount vertikale Sections.
+    // Eine Section ist entweder "uniform" (nur eine Id, keine Allokation) oder
+    // palette-komprimiert in einem BlockStorage. Adressierung ueber Index(lx, ly, lz);
+    // da Y die aeusserste Achse ist, liegt jede Section zusammenhaengend im Index-Raum.
+    //
+    // Kopien teilen sich die Section-Speicher (Copy-on-Write): geschrieben wird erst
+    // nach einer Kopie der betroffenen Section, eine Kopie bleibt also unveraendert.
+    // Kopiert werden darf nur vom Schreiber unter dem Chunk-Mutex (Chunk::PublishUnsafe);
+    // Leser teilen den Schnappschuss per shared_ptr. Darauf beruht die use_count()-Pruefung.
+    //
+    // Dazu eine Hoehenkarte (oberster Block pro Spalte) und der belegte Y-Bereich,
+    // bei jedem Schreibzugriff mitgefuehrt: Mesher und Abfragen ueberspringen den Luftraum.
+    class ChunkBlocks {
+    public:
+        ChunkBlocks() { heights_.fill(-1); }
+
+        // Kopiert nur Sections und Hoehen; Reserve-Speicher gehoeren allein dieser Instanz
+        ChunkBlocks(const ChunkBlocks& other)
+            : sections_(other.sections_), heights_(other.heights_), minY_(other.minY_), maxY_(other.maxY_) {
+        }
+        ChunkBlocks& operator=(const ChunkBlocks& other) {
+            sections_ = other.sections_;
+            heights_ = other.heights_;
+            minY_ = other.minY_;
+            maxY_ = other.maxY_;
+            return *this;
+        }
+
+        BlockId Get(int index) const {
+            const Section& s = sections_[static_cast<std::size_t>(index / SectionVolume)];
+            return s.data ? s.data->Get(index % SectionVolume) : s.uniformId;
+        }
+
+        void Set(int index, BlockId id);
+
+        void Fill(BlockId id);
+        void FillSection(int sy, BlockId id);
+
+        // Palettes kompaktieren und einheitliche Sections wieder freigeben
+        void Compact();
+
+        // Alles auf Air; nicht geteilte Section-Speicher werden als Reserve behalten
+        // und beim naechsten Materialisieren wiederverwendet (Kapazitaet bleibt).
+        void Reset();
+
+        bool IsSectionUniform(int sy) const { return !sections_[static_cast<std::size_t>(sy)].data; }
+
+        // Id einer uniformen Section (nur gueltig wenn IsSectionUniform(sy))
+        BlockId SectionId(int sy) const { return sections_[static_cast<std::size_t>(sy)].uniformId; }
+
+        // nullptr fuer uniforme Sections
+        const BlockStorage* SectionStorage(int sy) const { return sections_[static_cast<std::size_t>(sy)].data.get(); }
+
+        // Oberster Nicht-Air-Block der Spalte (lx, lz), -1 = Spalte leer
+        int Height(int lx, int lz) const { return heights_[static_cast<std::size_t>(lz * ChunkX + lx)]; }
+
+        // Belegter Bereich [MinY(), MaxY()], MaxY() < 0 = Chunk leer. MaxY() ist exakt,
+        // MinY() nur eine untere Schranke: beim Abbauen wird sie nicht angehoben, erst
+        // RecomputeHeights() macht sie wieder exakt.
+        int MinY() const { return minY_; }
+        int MaxY() const { return maxY_; }
+        bool IsEmpty() const { return maxY_ < 0; }
+
+        // Hoehenkarte und Y-Bereich komplett neu berechnen (nach dem Generieren);
+        // uniforme Sections kosten dabei nichts, Paletten werden zeilenweise dekodiert
+        void RecomputeHeights();
+
+        std::size_t MemoryUsage() const;
+
+    private:
+        // Section fuer Schreibzugriff exklusiv machen (kopiert, falls geteilt)
+        static BlockStorage& MakeUnique(std::shared_ptr<BlockStorage>& data);
+        std::shared_ptr<BlockStorage> NewSection(BlockId fill);
+
+        // Hoehen nach dem Schreiben von id an index nachfuehren
+        void UpdateHeight(int index, BlockId id);
+        // Oberster Nicht-Air-Block der Spalte bei y <= fromY, sonst -1
+        int ScanDown(int column, int fromY) const;
+        void UpdateMaxY();
+
+        struct Section {
+            BlockId uniformId = Air;
+            std::shared_ptr<BlockStorage> data;
+        };
+
+        std::array<Section, SectionCount> sections_;
+        std::vector<std::shared_ptr<BlockStorage>> spares_;
+
+        std::array<std::int16_t, ChunkX * ChunkZ> heights_;   // Index lz * ChunkX + lx
+        int minY_ = ChunkY;
+        int maxY_ = -1;
+    };
+
+} // namespace BrickWorlds::Voxel
@@ -28,4 +28,15 @@ namespace BrickWorlds::Voxel {
         }
     };
 
+    // Verlustfreie 64-Bit-Packung, z.B. als Job-Tag
+    inline std::uint64_t PackChunkKey(const ChunkKey& k) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(k.cx)) << 32) |
+            static_cast<std::uint32_t>(k.cz);
+    }
+
+    inline ChunkKey UnpackChunkKey(std::uint64_t packed) {
+        return ChunkKey{ static_cast<std::int32_t>(static_cast<std::uint32_t>(packed >> 32)),
+                         static_cast<std::int32_t>(static_cast<std::uint32_t>(packed)) };
+    }
+
 } // namespace BrickWorlds::Voxel
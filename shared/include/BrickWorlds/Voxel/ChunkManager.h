@@ -1,24 +1,51 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <shared_mutex>
-#include <unordered_map>
 #include <vector>
 
 #include "Chunk.h"
+#include "ChunkMap.h"
 
 namespace BrickWorlds::Voxel {
 
+    struct ChunkPoolStats {
+        std::uint64_t hits = 0;         // GetOrCreate aus dem Pool bedient
+        std::uint64_t misses = 0;       // GetOrCreate musste neu allokieren
+        std::uint64_t recycled = 0;     // freigegebener Chunk ging zurueck in den Pool
+        std::uint64_t dropped = 0;      // freigegebener Chunk verworfen (Pool voll)
+        std::size_t pooled = 0;         // aktuell im Pool
+        std::size_t residentBytes = 0;  // Speicher der gepoolten Chunks (inkl. Reserve-Puffer)
+
+        double HitRate() const {
+            const std::uint64_t total = hits + misses;
+            return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+        }
+    };
+
+    class ChunkPool;
+
     class ChunkManager {
     public:
+        static constexpr std::size_t DefaultPoolCapacity = 64;
+
+        explicit ChunkManager(std::size_t poolCapacity = DefaultPoolCapacity);
+        ~ChunkManager();
+
         std::shared_ptr<Chunk> GetChunk(const ChunkKey& key) const;
         std::shared_ptr<Chunk> GetOrCreate(const ChunkKey& key);
 
         void Remove(const ChunkKey& key);
         std::vector<std::shared_ptr<Chunk>> SnapshotAll() const;
 
+        // Begrenzter Pool: Chunks kehren beim Freigeben der letzten Referenz
+        // (auch aus Worker-Jobs) zurueck und werden samt Block-/Mesh-Puffern recycelt.
+        void SetPoolCapacity(std::size_t capacity);
+        ChunkPoolStats PoolStats() const;
+
     private:
-        mutable std::shared_mutex mtx_;
-        std::unordered_map<ChunkKey, std::shared_ptr<Chunk>, ChunkKeyHash> chunks_;
+        std::shared_ptr<ChunkPool> pool_; // vor chunks_: lebt laenger als die Map
+        ChunkMap chunks_;
     };
 
 } // namespace BrickWorlds::Voxel
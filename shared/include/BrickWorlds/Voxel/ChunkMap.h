@@ -0,0 +1,63 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "Chunk.h"
+#include "ChunkKey.h"
+
+namespace BrickWorlds::Voxel {
+
+    // N-fach geshardete Hash-Map ChunkKey -> Chunk mit Open Addressing (Linear Probing).
+    // Die oberen Hash-Bits (splitmix, ChunkKeyHash) waehlen den Shard, die unteren den Slot.
+    // Jeder Shard hat sein eigenes shared_mutex, Threads auf verschiedenen Shards
+    // kommen sich also nicht in die Quere.
+    class ChunkMap {
+    public:
+        static constexpr std::size_t ShardBits = 4;
+        static constexpr std::size_t ShardCount = std::size_t{ 1 } << ShardBits;
+
+        ChunkMap();
+
+        std::shared_ptr<Chunk> Find(const ChunkKey& key) const;
+
+        // Fuegt value ein, falls key fehlt. Liefert den Eintrag, der danach in der Map steht.
+        std::shared_ptr<Chunk> Insert(const ChunkKey& key, std::shared_ptr<Chunk> value);
+
+        // Entfernt key und gibt den entfernten Eintrag zurueck (nullptr, falls nicht vorhanden)
+        std::shared_ptr<Chunk> Erase(const ChunkKey& key);
+
+        void Snapshot(std::vector<std::shared_ptr<Chunk>>& out) const;
+        std::size_t Size() const;
+
+    private:
+        enum class SlotState : std::uint8_t { Empty = 0, Full, Deleted };
+
+        struct Slot {
+            ChunkKey key;
+            SlotState state = SlotState::Empty;
+            std::shared_ptr<Chunk> value;
+        };
+
+        struct alignas(64) Shard {
+            mutable std::shared_mutex mtx;
+            std::vector<Slot> slots;   // Groesse: Zweierpotenz
+            std::size_t size = 0;
+            std::size_t deleted = 0;
+        };
+
+        static std::uint64_t Hash(const ChunkKey& key) { return ChunkKeyHash{}(key); }
+        Shard& ShardFor(std::uint64_t hash) { return shards_[hash >> (64 - ShardBits)]; }
+        const Shard& ShardFor(std::uint64_t hash) const { return shards_[hash >> (64 - ShardBits)]; }
+
+        // Slot-Index des Keys oder -1 (Shard muss gelockt sein)
+        static std::ptrdiff_t FindSlot(const Shard& shard, const ChunkKey& key, std::uint64_t hash);
+        static void Rehash(Shard& shard, std::size_t newCapacity);
+
+        std::array<Shard, ShardCount> shards_;
+    };
+
+} // namespace BrickWorlds::Voxel
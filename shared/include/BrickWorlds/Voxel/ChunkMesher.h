@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+
+#include "BlockId.h"
+#include "Chunk.h"
+#include "ChunkKey.h"
+#include "FaceMask.h"
+#include "PaddedChunk.h"
+
+namespace BrickWorlds::Voxel {
+
+    // Chunk + 4 Nachbarn als lock-freie Schnappschuesse (fehlender Nachbar = leere View)
+    struct MeshNeighborhood {
+        ChunkKey key;
+        ChunkReadView center;
+        ChunkReadView minusX;
+        ChunkReadView plusX;
+        ChunkReadView minusZ;
+        ChunkReadView plusZ;
+    };
+
+    // Belegungsmasken des Chunks plus Randspalten der Nachbarn (Eingabe fuer ComputeFaceMasks)
+    void BuildOccupancy(const PaddedChunk& padded, ChunkOccupancy& out);
+
+    // Block-Farbe (Renderer-Palette, Shader schattiert pro Seite)
+    void BlockColor(BlockId id, float& r, float& g, float& b);
+
+    enum class MeshMode : std::uint8_t {
+        Naive,    // ein Quad pro sichtbarer Blockseite
+        Greedy    // koplanare Nachbarseiten gleicher Block-Id zu maximalen Rechtecken (je Section) zusammengefasst
+    };
+
+    // GL-freier Face-Culling-Mesher, laeuft auf den Mesh-Workern.
+    // Sichtbare Seiten kommen aus dem Bitmask-Kernel (FaceMask.h), nicht aus Einzelabfragen.
+    // Quads aus je 4 PackedVertex in Chunk-lokalen Koordinaten, nach Mesh-Bucket sortiert.
+    // Seiten zu nicht geladenen Nachbarn werden nicht erzeugt.
+    class ChunkMesher {
+    public:
+        explicit ChunkMesher(MeshMode mode = MeshMode::Greedy) : mode_(mode) {}
+
+        // out wird geleert und neu befuellt (Kapazitaet bleibt erhalten)
+        void Build(const PaddedChunk& padded, ChunkMeshData& out) const;
+        // Kopiert n vorher in einen PaddedChunk pro Thread
+        void Build(const MeshNeighborhood& n, ChunkMeshData& out) const;
+
+        // Inkrementell: nur die Buckets in dirty neu erzeugen, alle anderen aus previous
+        // uebernehmen. padded braucht die dirty Sections und je eine Section darueber/darunter.
+        void Update(const PaddedChunk& padded, const MeshDirtyMask& dirty, const ChunkMeshData& previous, ChunkMeshData& out) const;
+        // Kopiert dafuer nur die benoetigten Sections von n
+        void Update(const MeshNeighborhood& n, const MeshDirtyMask& dirty, const ChunkMeshData& previous, ChunkMeshData& out) const;
+
+        // LOD-Mesh (lod 1..MaxLod, lod 0 = Build) aus einem komplett kopierten PaddedChunk.
+        // Gleiches Vertex-Format und gleiche Buckets, Quads auf dem 2^lod-Raster.
+        void BuildLod(const PaddedChunk& padded, int lod, ChunkMeshData& out) const;
+        void BuildLod(const MeshNeighborhood& n, int lod, ChunkMeshData& out) const;
+
+        MeshMode Mode() const { return mode_; }
+
+        // Sections, die Update fuer dirty im PaddedChunk braucht
+        static std::uint32_t RequiredSections(const MeshDirtyMask& dirty);
+
+    private:
+        void BuildNaive(const PaddedChunk& padded, const ChunkFaceMasks& faces, int sy, int face, ChunkMeshData& out) const;
+        void BuildGreedy(const PaddedChunk& padded, const ChunkFaceMasks& faces, int sy, int face, ChunkMeshData& out) const;
+
+        MeshMode mode_;
+    };
+
+} // namespace BrickWorlds::Voxel
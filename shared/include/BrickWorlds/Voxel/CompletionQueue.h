@@ -0,0 +1,63 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace BrickWorlds::Voxel {
+
+    // Lock-freie MPSC-Queue: beliebig viele Producer pushen (Treiber-Stack per CAS),
+    // ein einzelner Consumer holt mit Drain() alles auf einmal ab (exchange, dann FIFO).
+    // Kein ABA-Problem, da nie einzelne Knoten gepoppt werden.
+    template <typename T>
+    class CompletionQueue {
+    public:
+        CompletionQueue() = default;
+        ~CompletionQueue() { Drain([](T&&) {}); }
+
+        CompletionQueue(const CompletionQueue&) = delete;
+        CompletionQueue& operator=(const CompletionQueue&) = delete;
+
+        void Push(T value) {
+            Node* node = new Node{ std::move(value), head_.load(std::memory_order_relaxed) };
+            while (!head_.compare_exchange_weak(node->next, node,
+                std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+
+        // Nur vom Consumer-Thread: fn(T&&) fuer jeden Eintrag in Push-Reihenfolge
+        template <typename Fn>
+        std::size_t Drain(Fn&& fn) {
+            Node* list = head_.exchange(nullptr, std::memory_order_acquire);
+
+            // Stack umdrehen -> aelteste zuerst
+            Node* fifo = nullptr;
+            while (list) {
+                Node* next = list->next;
+                list->next = fifo;
+                fifo = list;
+                list = next;
+            }
+
+            std::size_t n = 0;
+            while (fifo) {
+                Node* next = fifo->next;
+                fn(std::move(fifo->value));
+                delete fifo;
+                fifo = next;
+                ++n;
+            }
+            return n;
+        }
+
+        bool Empty() const { return head_.load(std::memory_order_acquire) == nullptr; }
+
+    private:
+        struct Node {
+            T value;
+            Node* next;
+        };
+
+        std::atomic<Node*> head_{ nullptr };
+    };
+
+} // namespace BrickWorlds::Voxel
@@ -0,0 +1,44 @@
+#pragma once
+#include <cstddef>
+#include <unordered_set>
+#include <vector>
+
+#include "ChunkKey.h"
+
+namespace BrickWorlds::Voxel {
+
+    // Persistente Arbeitsliste fuer Chunks (z.B. fertige Meshes, die noch hochgeladen werden muessen),
+    // in Ringe nach Chebyshev-Abstand zum Center einsortiert. Push/Pop sind O(1) amortisiert;
+    // neu einsortiert wird nur, wenn sich das Center aendert. Kosten pro Frame ~ tatsaechliche Arbeit.
+    // Nicht thread-safe (ein Consumer, z.B. Render-Thread).
+    class DirtyChunkQueue {
+    public:
+        // Center aendern: alle wartenden Keys neu einsortieren (O(n), nur bei Chunk-Wechsel)
+        void SetCenter(const ChunkKey& center);
+        const ChunkKey& Center() const { return center_; }
+
+        // Schon enthaltene Keys werden nicht doppelt eingereiht
+        void Push(const ChunkKey& key);
+        // Key verwerfen (z.B. Chunk entladen); false = war nicht enthalten
+        bool Remove(const ChunkKey& key);
+
+        // Naechsten Key (kleinster Ring) entnehmen; false = leer
+        bool TryPop(ChunkKey& out);
+
+        bool Contains(const ChunkKey& key) const { return pending_.count(key) != 0; }
+        std::size_t Size() const { return pending_.size(); }
+        bool Empty() const { return pending_.empty(); }
+        void Clear();
+
+    private:
+        int RingOf(const ChunkKey& key) const;
+        void Insert(const ChunkKey& key);
+
+        ChunkKey center_;
+        // rings_[d]: Keys mit Abstand d; kann verworfene Keys enthalten (nicht mehr in pending_)
+        std::vector<std::vector<ChunkKey>> rings_;
+        std::size_t firstRing_ = 0;   // alle Ringe davor sind leer
+        std::unordered_set<ChunkKey, ChunkKeyHash> pending_;
+    };
+
+} // namespace BrickWorlds::Voxel
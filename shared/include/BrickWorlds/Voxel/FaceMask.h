@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "BlockId.h"
+
+namespace BrickWorlds::Voxel {
+
+    inline constexpr int ColumnWords = ChunkY / 64;
+
+    inline int PopCount64(std::uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        return static_cast<int>(__popcnt64(v));
+#elif defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(v);
+#else
+        int n = 0;
+        for (; v; v &= v - 1) ++n;
+        return n;
+#endif
+    }
+
+    // v != 0
+    inline int CountTrailingZeros64(std::uint64_t v) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long i;
+        _BitScanForward64(&i, v);
+        return static_cast<int>(i);
+#elif defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(v);
+#else
+        int n = 0;
+        while (!(v & 1)) { v >>= 1; ++n; }
+        return n;
+#endif
+    }
+
+    // Belegung einer Block-Spalte: Bit y gesetzt = Block (lx, y, lz) ist nicht Air
+    struct alignas(32) ColumnMask {
+        std::uint64_t w[ColumnWords] = {};
+
+        bool Test(int y) const { return (w[y >> 6] >> (y & 63)) & 1u; }
+        void Set(int y) { w[y >> 6] |= std::uint64_t{ 1 } << (y & 63); }
+
+        int Count() const {
+            int n = 0;
+            for (std::uint64_t x : w) n += PopCount64(x);
+            return n;
+        }
+    };
+
+    // Spalten des Chunks plus eine Spalte Rand ringsum aus den Nachbar-Chunks.
+    // Nicht geladene Nachbarn: Rand voll belegt (keine Seiten zur Grenze hin).
+    struct ChunkOccupancy {
+        static constexpr int Width = ChunkX + 2;
+        static constexpr int Depth = ChunkZ + 2;
+
+        ColumnMask cols[Width * Depth];
+
+        // lx, lz: -1..16
+        ColumnMask& At(int lx, int lz) { return cols[(lz + 1) * Width + (lx + 1)]; }
+        const ColumnMask& At(int lx, int lz) const { return cols[(lz + 1) * Width + (lx + 1)]; }
+    };
+
+    // Sichtbare Seiten pro Richtung (+Z, -Z, +Y, -Y, +X, -X) und Spalte
+    struct ChunkFaceMasks {
+        ColumnMask faces[6][ChunkX * ChunkZ];
+
+        const ColumnMask& At(int face, int lx, int lz) const { return faces[face][lz * ChunkX + lx]; }
+    };
+
+    // Bitmask-Kernel: Seite sichtbar = belegt AND NOT Nachbar belegt, ganze Spalten auf einmal.
+    // AVX2-Pfad, wenn mit BRICKWORLDS_ENABLE_AVX2 gebaut, sonst SSE2 bzw. skalar.
+    void ComputeFaceMasks(const ChunkOccupancy& occ, ChunkFaceMasks& out);
+
+    // "avx2", "sse2" oder "scalar"
+    const char* FaceMaskKernelName();
+
+} // namespace BrickWorlds::Voxel
@@ -15,7 +15,7 @@ namespace BrickWorlds::Voxel {
                         BlockId id = Air;
                         if (y < 58) id = Rock;
                         else if (y < 60) id = Dirt;
-                        b[Index(x, y, z)] = id;
+                        b.Set(Index(x, y, z), id);
                     }
                 }
             }
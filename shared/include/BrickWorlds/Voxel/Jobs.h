@@ -1,34 +1,117 @@
 #pragma once
-#include <condition_variable>
-#include <functional>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
-#include <queue>
-#include <thread>
 #include <vector>
-#include <atomic>
+
+#include "TaskScheduler.h"
 
 namespace BrickWorlds::Voxel {
 
+    struct JobQueueStats {
+        std::uint64_t submitted = 0;
+        std::uint64_t completed = 0;
+        std::uint64_t cancelled = 0;
+        std::size_t pending = 0;
+        double busySeconds = 0.0;   // Summe der Job-Laufzeiten (ueber alle Worker)
+        double wallSeconds = 0.0;   // seit ResetStats()
+
+        double Throughput() const { return wallSeconds > 0.0 ? static_cast<double>(completed) / wallSeconds : 0.0; }
+    };
+
+    // Prioritaets-Queue einer Pipeline-Stufe: kleinere Prioritaet laeuft zuerst, bei Gleichstand FIFO.
+    // Jeder Job traegt ein Tag (z.B. gepackter ChunkKey), ueber das wartende Jobs
+    // neu priorisiert oder verworfen werden koennen.
+    // Die Jobs laufen auf dem gemeinsamen TaskScheduler: pro Enqueue wird ein Pump-Task
+    // eingereicht, der beim Ausfuehren den aktuell dringendsten Job der Queue zieht.
     class JobQueue {
     public:
-        using Job = std::function<void()>;
+        using Job = Task;
+        using Priority = std::int64_t;
+        using Tag = std::uint64_t;
+
+        explicit JobQueue(TaskScheduler& scheduler);
+        ~JobQueue() { Clear(); }
+
+        JobQueue(const JobQueue&) = delete;
+        JobQueue& operator=(const JobQueue&) = delete;
+
+        void Enqueue(Job job, Priority priority = 0, Tag tag = 0);
 
-        JobQueue() = default;
-        ~JobQueue() { Stop(); }
+        // Verwirft wartende Jobs, deren Tag pred erfuellt (laufende Jobs sind nicht betroffen).
+        // Rueckgabe: Anzahl verworfener Jobs.
+        template <typename Pred>
+        std::size_t CancelIf(Pred&& pred);
 
-        void Start(std::size_t threads);
-        void Stop();
+        // Berechnet die Prioritaet aller wartenden Jobs neu
+        template <typename PriorityOf>
+        void Reprioritize(PriorityOf&& priorityOf);
 
-        void Enqueue(Job job);
+        // Verwirft alle wartenden Jobs
+        std::size_t Clear();
+
+        std::size_t Pending() const;
+
+        JobQueueStats Stats() const;
+        void ResetStats();
 
     private:
-        void WorkerLoop();
+        struct Entry {
+            Priority priority = 0;
+            std::uint64_t seq = 0;
+            Tag tag = 0;
+            Job job;
+        };
+
+        // std::*_heap ist ein Max-Heap: "groesser" = spaeter dran
+        struct Later {
+            bool operator()(const Entry& a, const Entry& b) const {
+                return (a.priority != b.priority) ? (a.priority > b.priority) : (a.seq > b.seq);
+            }
+        };
+
+        // Pump-Task: dringendsten Job ziehen und ausfuehren (no-op, falls inzwischen verworfen)
+        void RunNext();
+        void RebuildHeap();
+
+        TaskScheduler& scheduler_;
 
-        std::mutex mtx_;
-        std::condition_variable cv_;
-        std::queue<Job> q_;
-        std::vector<std::thread> workers_;
-        std::atomic<bool> running_{ false };
+        mutable std::mutex mtx_;
+        std::vector<Entry> heap_;
+        std::uint64_t nextSeq_ = 0;
+
+        std::uint64_t submitted_ = 0;    // unter mtx_
+        std::uint64_t cancelled_ = 0;    // unter mtx_
+        std::atomic<std::uint64_t> completed_{ 0 };
+        std::atomic<std::uint64_t> busyNs_{ 0 };
+        std::chrono::steady_clock::time_point statsSince_ = std::chrono::steady_clock::now();
     };
 
+    template <typename Pred>
+    std::size_t JobQueue::CancelIf(Pred&& pred) {
+        std::lock_guard lk(mtx_);
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < heap_.size(); ++i) {
+            if (pred(heap_[i].tag)) continue;
+            if (kept != i) heap_[kept] = std::move(heap_[i]);
+            ++kept;
+        }
+        const std::size_t removed = heap_.size() - kept;
+        if (removed == 0) return 0;
+
+        heap_.erase(heap_.begin() + static_cast<std::ptrdiff_t>(kept), heap_.end());
+        cancelled_ += removed;
+        RebuildHeap();
+        return removed;
+    }
+
+    template <typename PriorityOf>
+    void JobQueue::Reprioritize(PriorityOf&& priorityOf) {
+        std::lock_guard lk(mtx_);
+        for (auto& e : heap_) e.priority = priorityOf(e.tag);
+        RebuildHeap();
+    }
+
 } // namespace BrickWorlds::Voxel
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+
+#include "BlockId.h"
+
+namespace BrickWorlds::Voxel {
+
+    // 8-Byte-Vertex in Chunk-lokalen Koordinaten (Ursprung legt der Renderer fest).
+    // position: x 5 Bit | z 5 Bit | y 9 Bit | face 3 Bit | ao 2 Bit | 8 Bit frei
+    // block:    BlockId 16 Bit | 16 Bit frei (Client: Arena-Handle fuer den Chunk-Ursprung)
+    // x/z laufen 0..16 und y 0..256, da Quad-Ecken auf der Chunk-Grenze liegen koennen.
+    struct PackedVertex {
+        std::uint32_t position = 0;
+        std::uint32_t block = 0;
+    };
+    static_assert(sizeof(PackedVertex) == 8, "PackedVertex muss 8 Bytes gross sein");
+
+    inline constexpr int VertexXBits = 5;
+    inline constexpr int VertexZBits = 5;
+    inline constexpr int VertexYBits = 9;
+    inline constexpr int VertexFaceBits = 3;
+    inline constexpr int VertexAoBits = 2;
+
+    inline constexpr int VertexZShift = VertexXBits;
+    inline constexpr int VertexYShift = VertexZShift + VertexZBits;
+    inline constexpr int VertexFaceShift = VertexYShift + VertexYBits;
+    inline constexpr int VertexAoShift = VertexFaceShift + VertexFaceBits;
+
+    // Seiten-Reihenfolge im face-Feld (auch Mesher und Shader)
+    enum MeshFace : int {
+        FacePlusZ = 0,
+        FaceMinusZ,
+        FacePlusY,
+        FaceMinusY,
+        FacePlusX,
+        FaceMinusX,
+        MeshFaceCount
+    };
+
+    // AO 3 = nicht verdeckt
+    inline constexpr int VertexAoNone = 3;
+
+    static_assert(ChunkX < (1 << VertexXBits) && ChunkZ < (1 << VertexZBits) && ChunkY < (1 << VertexYBits),
+        "Chunk-Abmessungen passen nicht ins Vertex-Format");
+
+    struct UnpackedVertex {
+        int x = 0;
+        int y = 0;
+        int z = 0;
+        int face = 0;     // 0..5: +Z, -Z, +Y, -Y, +X, -X
+        int ao = VertexAoNone;
+        BlockId id = Air;
+    };
+
+    inline constexpr PackedVertex PackVertex(int x, int y, int z, int face, BlockId id, int ao = VertexAoNone) {
+        PackedVertex v;
+        v.position = (static_cast<std::uint32_t>(x) & ((1u << VertexXBits) - 1))
+            | ((static_cast<std::uint32_t>(z) & ((1u << VertexZBits) - 1)) << VertexZShift)
+            | ((static_cast<std::uint32_t>(y) & ((1u << VertexYBits) - 1)) << VertexYShift)
+            | ((static_cast<std::uint32_t>(face) & ((1u << VertexFaceBits) - 1)) << VertexFaceShift)
+            | ((static_cast<std::uint32_t>(ao) & ((1u << VertexAoBits) - 1)) << VertexAoShift);
+        v.block = id;
+        return v;
+    }
+
+    inline constexpr UnpackedVertex UnpackVertex(const PackedVertex& v) {
+        UnpackedVertex u;
+        u.x = static_cast<int>(v.position & ((1u << VertexXBits) - 1));
+        u.z = static_cast<int>((v.position >> VertexZShift) & ((1u << VertexZBits) - 1));
+        u.y = static_cast<int>((v.position >> VertexYShift) & ((1u << VertexYBits) - 1));
+        u.face = static_cast<int>((v.position >> VertexFaceShift) & ((1u << VertexFaceBits) - 1));
+        u.ao = static_cast<int>((v.position >> VertexAoShift) & ((1u << VertexAoBits) - 1));
+        u.id = static_cast<BlockId>(v.block & 0xffffu);
+        return u;
+    }
+
+} // namespace BrickWorlds::Voxel
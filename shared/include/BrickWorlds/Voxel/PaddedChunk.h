@@ -0,0 +1,79 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "BlockId.h"
+
+namespace BrickWorlds::Voxel {
+
+    struct MeshNeighborhood;
+
+    // Bits fuer fehlende Nachbarn (PaddedChunk::missing, Chunk::MissingNeighbors)
+    inline constexpr std::uint8_t NeighborMinusX = 1u << 0;
+    inline constexpr std::uint8_t NeighborPlusX = 1u << 1;
+    inline constexpr std::uint8_t NeighborMinusZ = 1u << 2;
+    inline constexpr std::uint8_t NeighborPlusZ = 1u << 3;
+
+    // Bit des Nachbarn in Richtung (dx, dz), nur einer der beiden != 0
+    inline constexpr std::uint8_t NeighborBit(int dx, int dz) {
+        return dx < 0 ? NeighborMinusX : dx > 0 ? NeighborPlusX : dz < 0 ? NeighborMinusZ : NeighborPlusZ;
+    }
+
+    // Chunk plus ein Voxel Rand aus den 4 Nachbarn als zusammenhaengendes 18x256x18-Array.
+    // Der Mesher arbeitet nur noch darauf: keine Views, keine Palette-Dekodierung, keine Locks.
+    // Y ist die aeusserste Achse wie bei Index(), Eckspalten bleiben ungenutzt.
+    struct PaddedChunk {
+        static constexpr int Width = ChunkX + 2;
+        static constexpr int Depth = ChunkZ + 2;
+        static constexpr int Volume = Width * ChunkY * Depth;
+
+        std::vector<BlockId> blocks = std::vector<BlockId>(static_cast<std::size_t>(Volume), Air);
+
+        // Sections, die im Chunk selbst komplett Air sind. Deren Zeilen (inkl. Rand)
+        // werden nicht kopiert und haben undefinierten Inhalt.
+        bool emptySection[SectionCount] = {};
+
+        // Kopierte Sections (Bit sy); die uebrigen sind undefiniert
+        std::uint32_t sections = 0;
+
+        // Belegter Y-Bereich des Chunks (ChunkBlocks::MinY/MaxY). Nur diese Zeilen werden
+        // kopiert, alle anderen (auch im Rand) sind undefiniert und gelten als Air.
+        int minY = 0;
+        int maxY = ChunkY - 1;
+
+        // Nicht geladene Nachbarn (Neighbor*-Bits): deren Rand wird nicht kopiert und gilt als solide
+        std::uint8_t missing = 0;
+
+        // lx, lz: -1..16
+        static constexpr int PaddedIndex(int lx, int ly, int lz) {
+            return (ly * Depth + (lz + 1)) * Width + (lx + 1);
+        }
+
+        BlockId Get(int lx, int ly, int lz) const { return blocks[static_cast<std::size_t>(PaddedIndex(lx, ly, lz))]; }
+    };
+
+    // Detailstufen fuer entfernte Chunks: Stufe lod fasst (2^lod)^3 Bloecke zu einer Zelle zusammen
+    inline constexpr int MaxLod = 3;
+    inline constexpr int LodScale(int lod) { return 1 << lod; }
+    static_assert((1 << MaxLod) <= SectionY && (1 << MaxLod) <= ChunkX && ChunkX == ChunkZ, "LOD-Zellen muessen in eine Section passen");
+
+    // Neighbor*-Bits der leeren Views in n
+    std::uint8_t MissingNeighbors(const MeshNeighborhood& n);
+
+    inline constexpr std::uint32_t AllSections = (1u << SectionCount) - 1;
+    static_assert(SectionCount <= 32, "Section-Masken sind 32 Bit breit");
+
+    // Chunk und Rand in einem Durchlauf Section fuer Section kopieren
+    // (uniforme Sections per Fill, sonst linear durch den Section-Speicher).
+    // sections: nur diese Sections kopieren (inkrementelles Meshing)
+    void CopyPadded(const MeshNeighborhood& n, PaddedChunk& out, std::uint32_t sections = AllSections);
+
+    // LOD-Gitter in voller Aufloesung: jede Zelle wird mit einer Id gefuellt.
+    // Zelle solide bei Mehrheit solider Bloecke (Oberflaeche weicht max. eine halbe Zelle ab),
+    // Id = oberster solider Block der Zelle, damit die Oberflaechenfarbe erhalten bleibt.
+    // Der Rand ist die Randzelle um eine Zelle nach unten versetzt: an der Chunkgrenze
+    // haengt unter jeder Oberkante eine Zelle hohe Wand (Skirt) und deckt Risse zu
+    // Nachbarn anderer Stufe ab. src muss komplett kopiert sein.
+    void DownsamplePadded(const PaddedChunk& src, int lod, PaddedChunk& out);
+
+} // namespace BrickWorlds::Voxel
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "BlockId.h"
+#include "ChunkKey.h"
+#include "FaceMask.h"
+#include "PackedVertex.h"
+
+namespace BrickWorlds::Voxel {
+
+    // Verbindungsgraph einer Section (Cave-Culling): Bit FacePairBit(a, b) gesetzt = die Seiten
+    // a und b der Section sind ueber Air-Voxel verbunden. 15 Paare aus 6 Seiten (MeshFace).
+    inline constexpr std::uint16_t AllFacesConnected = 0x7fff;
+
+    inline constexpr int FacePairBit(int a, int b) {
+        if (a > b) { const int t = a; a = b; b = t; }
+        // Zeilen des oberen Dreiecks: a = 0 -> 0..4, a = 1 -> 5..8, ...
+        return a * (2 * MeshFaceCount - a - 1) / 2 + (b - a - 1);
+    }
+
+    inline constexpr bool FacesConnected(std::uint16_t connectivity, int a, int b) {
+        return a != b && ((connectivity >> FacePairBit(a, b)) & 1u);
+    }
+
+    // Gegenueberliegende Seite (+Z <-> -Z usw.)
+    inline constexpr int OppositeFace(int face) { return face ^ 1; }
+
+    // Flood-Fill der Air-Voxel von Section sy ueber die Belegungsmasken (BuildOccupancy).
+    // Leere Sections sind voll verbunden, massive haben keine Verbindung.
+    std::uint16_t SectionConnectivity(const ChunkOccupancy& occ, int sy);
+
+    // Sichtbare Sections per BFS ab der Kamera-Section durch offene Sections
+    // (Verfahren wie "Advanced Cave Culling"): eine Section wird nur ueber eine Seite verlassen,
+    // die mit der Eintrittsseite verbunden ist, und nie zurueck in Richtung Kamera.
+    // Chunks ohne SetChunk gelten als offen (noch nicht gemesht) und sichtbar.
+    class SectionOcclusion {
+    public:
+        // Neues Raster: Chunks bis radius (Chebyshev) um center
+        void Begin(const ChunkKey& center, int radius);
+
+        // connectivity: SectionCount Eintraege; inFrustum = false -> wird nicht betreten
+        void SetChunk(const ChunkKey& key, const std::uint16_t* connectivity, bool inFrustum);
+
+        // BFS ab Section cameraSy des Center-Chunks (ausserhalb 0..SectionCount-1: geklemmt)
+        void Traverse(int cameraSy);
+
+        // Erreichte Sections (Bit sy), 0 ausserhalb des Rasters
+        std::uint32_t VisibleSections(const ChunkKey& key) const;
+
+        std::size_t VisitedSectionCount() const { return visitedCount_; }
+
+    private:
+        struct Cell {
+            std::uint16_t connectivity[SectionCount];
+            std::uint32_t visited = 0;
+            bool inFrustum = true;
+        };
+
+        struct Node {
+            int cell;
+            int sy;
+            std::int8_t entry;       // Eintrittsseite, -1 = Start
+            std::uint8_t directions; // bisher gegangene Richtungen (Bit = MeshFace)
+        };
+
+        int CellIndex(int cx, int cz) const;
+
+        ChunkKey center_;
+        int radius_ = 0;
+        int width_ = 0;
+        std::vector<Cell> cells_;
+        std::vector<Node> queue_;
+        std::size_t visitedCount_ = 0;
+    };
+
+} // namespace BrickWorlds::Voxel
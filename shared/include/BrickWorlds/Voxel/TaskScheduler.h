@@ -0,0 +1,139 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace BrickWorlds::Voxel {
+
+    // Move-only Callable mit Inline-Speicher (keine Heap-Allokation pro Task).
+    // Captures muessen in InlineSize passen, sonst Compile-Fehler.
+    class Task {
+    public:
+        static constexpr std::size_t InlineSize = 48;
+
+        Task() noexcept = default;
+
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Task>>>
+        Task(F&& fn) {
+            using Fn = std::decay_t<F>;
+            static_assert(sizeof(Fn) <= InlineSize, "Task: Capture zu gross fuer Inline-Speicher");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t), "Task: Alignment nicht unterstuetzt");
+            static_assert(std::is_nothrow_move_constructible_v<Fn>, "Task: Callable muss nothrow-movable sein");
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(fn));
+            ops_ = &OpsFor<Fn>;
+        }
+
+        Task(Task&& other) noexcept { MoveFrom(other); }
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                Reset();
+                MoveFrom(other);
+            }
+            return *this;
+        }
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        ~Task() { Reset(); }
+
+        explicit operator bool() const noexcept { return ops_ != nullptr; }
+        void operator()() { ops_->invoke(storage_); }
+
+    private:
+        struct Ops {
+            void (*invoke)(void*);
+            void (*move)(void* dst, void* src);   // zerstoert src
+            void (*destroy)(void*);
+        };
+
+        template <typename Fn> static void Invoke(void* p) { (*static_cast<Fn*>(p))(); }
+        template <typename Fn> static void Move(void* dst, void* src) {
+            ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        }
+        template <typename Fn> static void Destroy(void* p) { static_cast<Fn*>(p)->~Fn(); }
+
+        template <typename Fn>
+        static constexpr Ops OpsFor{ &Invoke<Fn>, &Move<Fn>, &Destroy<Fn> };
+
+        void MoveFrom(Task& other) noexcept {
+            if (!other.ops_) return;
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+
+        void Reset() noexcept {
+            if (!ops_) return;
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+
+        alignas(std::max_align_t) unsigned char storage_[InlineSize];
+        const Ops* ops_ = nullptr;
+    };
+
+    struct TaskSchedulerStats {
+        std::uint64_t executed = 0;
+        std::uint64_t stolen = 0;     // aus fremder Worker-Deque geholt
+        std::size_t workers = 0;
+    };
+
+    // Work-Stealing-Pool: jeder Worker hat eine eigene Deque (eigene Tasks LIFO vom Ende,
+    // Diebe FIFO vom Anfang). Submits von aussen landen in einer Injector-Queue.
+    // Ohne Start() sammeln sich Tasks nur an; Start() arbeitet sie dann ab.
+    class TaskScheduler {
+    public:
+        TaskScheduler() = default;
+        ~TaskScheduler() { Stop(); }
+
+        TaskScheduler(const TaskScheduler&) = delete;
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+        // threads == 0: hardware_concurrency. Laeuft der Pool schon, werden die alten
+        // Worker beendet; wartende Tasks bleiben erhalten.
+        void Start(std::size_t threads = 0);
+        // Laufende Tasks werden fertig, wartende verworfen
+        void Stop();
+
+        void Submit(Task task);
+
+        std::size_t WorkerCount() const { return workers_.size(); }
+        TaskSchedulerStats Stats() const;
+
+    private:
+        struct alignas(64) Worker {
+            std::mutex mtx;
+            std::deque<Task> tasks;
+            std::thread thread;
+        };
+
+        // Worker beenden und joinen, ihre wartenden Tasks in den Injector verschieben
+        void JoinWorkers();
+        void WorkerLoop(std::size_t index);
+        bool TryPop(std::size_t index, Task& out);
+        bool TrySteal(std::size_t thief, Task& out);
+
+        std::vector<std::unique_ptr<Worker>> workers_;
+
+        std::mutex injectMtx_;
+        std::deque<Task> inject_;
+
+        std::mutex sleepMtx_;
+        std::condition_variable sleepCv_;
+        std::atomic<std::size_t> queued_{ 0 };
+        std::atomic<bool> running_{ false };
+
+        std::atomic<std::uint64_t> executed_{ 0 };
+        std::atomic<std::uint64_t> stolen_{ 0 };
+    };
+
+} // namespace BrickWorlds::Voxel
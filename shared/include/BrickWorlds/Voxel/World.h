@@ -1,9 +1,16 @@
 #pragma once
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "ChunkManager.h"
+#include "ChunkMesher.h"
+#include "CompletionQueue.h"
 #include "Jobs.h"
 
 namespace BrickWorlds::Voxel {
@@ -13,21 +20,87 @@ namespace BrickWorlds::Voxel {
         virtual void Generate(Chunk& chunk) = 0;
     };
 
+    struct BlockEdit {
+        int wx = 0;
+        int wy = 0;
+        int wz = 0;
+        BlockId id = Air;
+    };
+
+    // Fertiges CPU-Mesh eines Chunks; Daten per Chunks().GetChunk(key)->ReadMesh abholen
+    // (Chunk kann inzwischen entladen sein). unloaded = Chunk wurde entladen, Mesh freigeben.
+    struct MeshReady {
+        ChunkKey key;
+        bool unloaded = false;
+    };
+
+    // Durchsatz pro Pipeline-Stufe + Scheduler
+    struct StreamingStats {
+        JobQueueStats generate;
+        JobQueueStats mesh;
+        TaskSchedulerStats scheduler;
+    };
+
     class World {
     public:
         explicit World(IChunkGenerator* generator);
+        ~World();
 
-        // Streaming: Worker-Queues
-        void StartStreaming(std::size_t genThreads, std::size_t meshThreads);
+        // Streaming: Generate- und Mesh-Jobs teilen sich einen Work-Stealing-Pool,
+        // workerThreads == 0: hardware_concurrency
+        void StartStreaming(std::size_t workerThreads = 0);
         void StopStreaming();
+        StreamingStats StreamStats() const;
 
-        // Chunk Streaming: ldt/generiert Chunks im Radius um Player-Position (Blocks)
+        // Chunk Streaming: ldt/generiert Chunks im Radius um Player-Position (Blocks).
+        // Daten werden fuer viewDistanceChunks + 1 geladen, gemesht wird, sobald die Nachbarn da sind.
+        // Arbeitet inkrementell: nur bei Wechsel des Center-Chunks (oder Radius) wird
+        // der ein-/austretende Rand berechnet. Entladen erst ausserhalb Lade-Radius + Hysterese.
+        // Durch Edits ausserhalb des Entlade-Quadrats angelegte Chunks werden beim naechsten
+        // Aufruf wieder entladen (Edits und UpdateStreaming vom selben Thread).
         void UpdateStreaming(int playerWx, int playerWz, int viewDistanceChunks);
+        void SetUnloadHysteresis(int chunks);
+
+        // Generate-Jobs nach Entfernung zum Spieler abarbeiten, bei Bewegung neu sortieren
+        // und Jobs entladener Chunks verwerfen (Default). false = FIFO wie frueher (Vergleichsmessung).
+        void SetPrioritizedGeneration(bool enabled);
+
+        // Mesher-Modus fuer alle folgenden Mesh-Jobs (Default: Greedy)
+        void SetMeshMode(MeshMode mode);
+
+        // false: keine Mesh-Jobs und keine MeshReady-Ergebnisse, Chunks bleiben bei ReadyData
+        // (Server ohne Renderer: niemand leert DrainMeshResults). Vor StartStreaming setzen.
+        void SetMeshingEnabled(bool enabled);
+
+        // LOD-Meshes ab dieser Entfernung (Chunks, Quadrat-Ringe): bis chunks volle Aufloesung,
+        // bis 2x chunks LOD 1, bis 4x chunks LOD 2, dahinter LOD 3. 0 = aus (Default).
+        // Chunks, die die Stufe wechseln, werden komplett neu gemesht.
+        void SetLodDistance(int chunks);
 
         // Block API
         BlockId GetBlock(int wx, int wy, int wz) const;
         void SetBlock(int wx, int wy, int wz, BlockId id);
 
+        // Oberster Nicht-Air-Block der Spalte (Welt-Y) aus der Hoehenkarte,
+        // -1 = Spalte leer oder Chunk nicht geladen (z.B. Spawn-Hoehe, Raycast-Abbruch)
+        int GetHeight(int wx, int wz) const;
+
+        // Bulk-Edits: nach Chunk gruppiert, ein Lock + ein Publish pro Chunk,
+        // jeder betroffene Nachbar wird hoechstens einmal dirty markiert.
+        // Bei mehreren Edits auf denselben Block gewinnt der letzte.
+        // Rueckgabe: Anzahl tatsaechlich geaenderter Blocks.
+        std::size_t ApplyEdits(const BlockEdit* edits, std::size_t count);
+        std::size_t ApplyEdits(const std::vector<BlockEdit>& edits) { return ApplyEdits(edits.data(), edits.size()); }
+
+        // Box inklusive beider Ecken (Welt-Koordinaten)
+        std::size_t FillBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockId id);
+        std::size_t ReplaceInBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockId from, BlockId to);
+
+        // Nur vom Render-Thread: fn(MeshReady&&) fuer jedes seit dem letzten Aufruf fertige
+        // bzw. durch Entladen ungueltige Mesh
+        template <typename Fn>
+        std::size_t DrainMeshResults(Fn&& fn) { return meshResults_.Drain(std::forward<Fn>(fn)); }
+
         ChunkManager& Chunks() { return chunks_; }
         const ChunkManager& Chunks() const { return chunks_; }
 
@@ -35,16 +108,60 @@ namespace BrickWorlds::Voxel {
         static void WorldToLocal(int wx, int wy, int wz, int& lx, int& ly, int& lz);
 
     private:
-        void EnqueueGenerate(const std::shared_ptr<Chunk>& ch);
+        void EnqueueGenerate(const std::shared_ptr<Chunk>& ch, JobQueue::Priority priority = 0);
+        // Mesh-Job, sobald Chunk ReadyData und alle 4 Nachbarn Daten haben (ReadyData -> Meshing per CAS)
+        void TryScheduleMesh(const ChunkKey& ck);
+        // Chunk ck hat jetzt Daten: Nachbarn ggf. erstmals meshen bzw. einmal neu meshen,
+        // wenn ihnen ck beim letzten Mesh gefehlt hat
+        void OnDataReady(const ChunkKey& ck);
         void EnqueueMesh(const std::shared_ptr<Chunk>& ch);
+        // Nach Edits: ReadyMesh -> Meshing; laeuft gerade ein Mesh-Job, meshed dieser danach erneut
+        void RequestRemesh(const std::shared_ptr<Chunk>& ch);
+        void BuildMesh(const std::shared_ptr<Chunk>& ch);
+
+        // Aus der Map nehmen, laufende Jobs abbrechen lassen, Renderer benachrichtigen
+        void UnloadChunk(const ChunkKey& ck);
+        // Nach GetOrCreate in Edits: liegt ck ausserhalb des Entlade-Quadrats, erfasst ihn
+        // der Rand-Durchlauf von UpdateStreaming nie -> merken und dort entladen
+        void NoteEditedChunk(const ChunkKey& ck);
 
-        void MarkNeighborsDirtyIfEdge(const ChunkKey& ck, int lx, int lz);
+        // Mesh-Buckets, die Edits an der Chunk-Kante in den 4 Nachbarn betreffen (-X, +X, -Z, +Z)
+        struct EdgeDirty {
+            MeshDirtyMask neighbors[4];
+
+            // Edit-Bereich [lx0, lx1] x [ly0, ly1] x [lz0, lz1] im Chunk
+            void Add(int lx0, int ly0, int lz0, int lx1, int ly1, int lz1);
+        };
+
+        void MarkNeighborsDirty(const ChunkKey& ck, const EdgeDirty& edges);
+        void MarkNeighborsDirtyBatch(const std::vector<std::pair<ChunkKey, EdgeDirty>>& edgesPerChunk);
+
+        // Zerlegt die Box in Chunks; op(ChunkBlocks&, lx0, ly0, lz0, lx1, ly1, lz1)
+        // bearbeitet den lokalen Ausschnitt (inklusiv) und liefert die Anzahl Aenderungen.
+        template <typename Op>
+        std::size_t EditBox(int x0, int y0, int z0, int x1, int y1, int z1, Op&& op);
 
         ChunkManager chunks_;
         IChunkGenerator* generator_ = nullptr;
 
-        JobQueue genQ_;
-        JobQueue meshQ_;
+        TaskScheduler scheduler_;
+        JobQueue genQ_{ scheduler_ };
+        JobQueue meshQ_{ scheduler_ };
+        CompletionQueue<MeshReady> meshResults_;
+
+        // Streaming-Zustand des letzten UpdateStreaming (Radius -1 = noch nichts geladen)
+        ChunkKey streamCenter_;
+        int streamLoadRadius_ = -1;
+        int streamUnloadRadius_ = -1;
+        int unloadHysteresis_ = 2;
+        std::unordered_set<ChunkKey, ChunkKeyHash> strayChunks_;
+        bool prioritizedGeneration_ = true;
+        // Center fuer Mesh-Prioritaeten (Mesh-Jobs werden von Workern eingereiht)
+        std::atomic<std::uint64_t> priorityCenter_{ 0 };
+        std::atomic<MeshMode> meshMode_{ MeshMode::Greedy };
+        std::atomic<bool> meshingEnabled_{ true };
+        int lodDistance_ = 0;
+        bool lodChanged_ = false;
     };
 
 } // namespace BrickWorlds::Voxel
@@ -0,0 +1,107 @@
+#include "BrickWorlds/Core/ArenaAllocator.h"
+
+#include <iterator>
+
+namespace BrickWorlds {
+namespace Core {
+
+ArenaAllocator::ArenaAllocator(std::size_t capacity) {
+    grow(capacity);
+}
+
+void ArenaAllocator::insertFree(std::size_t offset, std::size_t size) {
+    m_freeByOffset.emplace(offset, size);
+    m_freeBySize.emplace(size, offset);
+}
+
+void ArenaAllocator::eraseFree(std::map<std::size_t, std::size_t>::iterator it) {
+    m_freeBySize.erase({ it->second, it->first });
+    m_freeByOffset.erase(it);
+}
+
+ArenaAllocator::Handle ArenaAllocator::allocate(std::size_t size) {
+    if (size == 0) size = 1;
+
+    // best fit: smallest free block that is large enough, lowest offset on ties
+    auto fit = m_freeBySize.lower_bound({ size, 0 });
+    if (fit == m_freeBySize.end()) {
+        ++m_stats.failedAllocations;
+        return InvalidHandle;
+    }
+
+    const std::size_t blockOffset = fit->second;
+    const std::size_t blockSize = fit->first;
+    eraseFree(m_freeByOffset.find(blockOffset));
+    if (blockSize > size) insertFree(blockOffset + size, blockSize - size);
+
+    Handle handle;
+    if (!m_freeHandles.empty()) {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+    } else {
+        handle = static_cast<Handle>(m_blocks.size());
+        m_blocks.emplace_back();
+    }
+    m_blocks[handle] = Block{ blockOffset, size, true };
+
+    m_stats.used += size;
+    ++m_stats.allocations;
+    return handle;
+}
+
+void ArenaAllocator::release(Handle handle) {
+    if (handle == InvalidHandle || handle >= m_blocks.size() || !m_blocks[handle].live) return;
+
+    Block& b = m_blocks[handle];
+    std::size_t offset = b.offset;
+    std::size_t size = b.size;
+    b.live = false;
+    m_freeHandles.push_back(handle);
+    m_stats.used -= size;
+    --m_stats.allocations;
+
+    // merge with free neighbours
+    auto next = m_freeByOffset.lower_bound(offset);
+    if (next != m_freeByOffset.end() && next->first == offset + size) {
+        size += next->second;
+        eraseFree(next);
+    }
+    auto prev = m_freeByOffset.lower_bound(offset);
+    if (prev != m_freeByOffset.begin()) {
+        --prev;
+        if (prev->first + prev->second == offset) {
+            offset = prev->first;
+            size += prev->second;
+            eraseFree(prev);
+        }
+    }
+    insertFree(offset, size);
+}
+
+void ArenaAllocator::grow(std::size_t newCapacity) {
+    if (newCapacity <= m_capacity) return;
+
+    std::size_t offset = m_capacity;
+    std::size_t size = newCapacity - m_capacity;
+    // a free block at the end grows with the arena
+    if (!m_freeByOffset.empty()) {
+        auto last = std::prev(m_freeByOffset.end());
+        if (last->first + last->second == m_capacity) {
+            offset = last->first;
+            size += last->second;
+            eraseFree(last);
+        }
+    }
+    insertFree(offset, size);
+    m_capacity = newCapacity;
+}
+
+const ArenaAllocator::Stats& ArenaAllocator::stats() const {
+    m_stats.capacity = m_capacity;
+    m_stats.freeBlocks = m_freeByOffset.size();
+    m_stats.largestFree = m_freeBySize.empty() ? 0 : m_freeBySize.rbegin()->first;
+    return m_stats;
+}
+
+} // namespace Core
+} // namespace BrickWorlds
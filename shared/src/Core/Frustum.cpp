@@ -0,0 +1,135 @@
+#include "BrickWorlds/Core/Frustum.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BRICKWORLDS_FRUSTUM_SSE 1
+#endif
+
+namespace BrickWorlds {
+namespace Core {
+
+void AabbBatch::clear() {
+    m_minX.clear(); m_minY.clear(); m_minZ.clear();
+    m_maxX.clear(); m_maxY.clear(); m_maxZ.clear();
+}
+
+void AabbBatch::add(const Aabb& box) {
+    m_minX.push_back(box.minX); m_minY.push_back(box.minY); m_minZ.push_back(box.minZ);
+    m_maxX.push_back(box.maxX); m_maxY.push_back(box.maxY); m_maxZ.push_back(box.maxZ);
+}
+
+void AabbBatch::reserve(std::size_t count) {
+    m_minX.reserve(count); m_minY.reserve(count); m_minZ.reserve(count);
+    m_maxX.reserve(count); m_maxY.reserve(count); m_maxZ.reserve(count);
+}
+
+Frustum Frustum::fromMatrices(const float* projection, const float* view) {
+    // column-major: m[col * 4 + row]
+    float viewProjection[16];
+    for (int col = 0; col < 4; ++col) {
+        for (int row = 0; row < 4; ++row) {
+            float sum = 0.0f;
+            for (int k = 0; k < 4; ++k) sum += projection[k * 4 + row] * view[col * 4 + k];
+            viewProjection[col * 4 + row] = sum;
+        }
+    }
+    return fromViewProjection(viewProjection);
+}
+
+Frustum Frustum::fromViewProjection(const float* m) {
+    // Gribb/Hartmann: planes are sums/differences of row 3 with rows 0..2
+    auto row = [m](int r, int c) { return m[c * 4 + r]; };
+    auto make = [&](int r, float sign) {
+        Plane p{ row(3, 0) + sign * row(r, 0), row(3, 1) + sign * row(r, 1),
+                 row(3, 2) + sign * row(r, 2), row(3, 3) + sign * row(r, 3) };
+        const float len = std::sqrt(p.a * p.a + p.b * p.b + p.c * p.c);
+        if (len > 0.0f) {
+            p.a /= len; p.b /= len; p.c /= len; p.d /= len;
+        }
+        return p;
+    };
+
+    Frustum f;
+    f.m_planes[Left] = make(0, 1.0f);
+    f.m_planes[Right] = make(0, -1.0f);
+    f.m_planes[Bottom] = make(1, 1.0f);
+    f.m_planes[Top] = make(1, -1.0f);
+    f.m_planes[Near] = make(2, 1.0f);
+    f.m_planes[Far] = make(2, -1.0f);
+    return f;
+}
+
+bool Frustum::intersects(const Aabb& box) const {
+    for (const Plane& p : m_planes) {
+        // corner furthest along the plane normal (p-vertex)
+        const float x = p.a >= 0.0f ? box.maxX : box.minX;
+        const float y = p.b >= 0.0f ? box.maxY : box.minY;
+        const float z = p.c >= 0.0f ? box.maxZ : box.minZ;
+        if (p.d + p.a * x + p.b * y + p.c * z < 0.0f) return false;
+    }
+    return true;
+}
+
+std::size_t Frustum::cull(const AabbBatch& boxes, std::vector<std::uint8_t>& visible) const {
+    const std::size_t count = boxes.size();
+    visible.resize(count);
+
+    // p-vertex per plane: the sign of the normal picks min or max array, no per-box select
+    const float* px[PlaneCount];
+    const float* py[PlaneCount];
+    const float* pz[PlaneCount];
+    for (int i = 0; i < PlaneCount; ++i) {
+        const Plane& p = m_planes[i];
+        px[i] = (p.a >= 0.0f ? boxes.m_maxX : boxes.m_minX).data();
+        py[i] = (p.b >= 0.0f ? boxes.m_maxY : boxes.m_minY).data();
+        pz[i] = (p.c >= 0.0f ? boxes.m_maxZ : boxes.m_minZ).data();
+    }
+
+    std::size_t visibleCount = 0;
+    std::size_t b = 0;
+
+#if defined(BRICKWORLDS_FRUSTUM_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    for (; b + 4 <= count; b += 4) {
+        __m128 inside = _mm_cmpeq_ps(zero, zero);
+        for (int i = 0; i < PlaneCount; ++i) {
+            const Plane& p = m_planes[i];
+            __m128 dist = _mm_set1_ps(p.d);
+            dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(p.a), _mm_loadu_ps(px[i] + b)));
+            dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(p.b), _mm_loadu_ps(py[i] + b)));
+            dist = _mm_add_ps(dist, _mm_mul_ps(_mm_set1_ps(p.c), _mm_loadu_ps(pz[i] + b)));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, zero));
+        }
+        const int mask = _mm_movemask_ps(inside);
+        for (int k = 0; k < 4; ++k) {
+            const std::uint8_t v = static_cast<std::uint8_t>((mask >> k) & 1);
+            visible[b + k] = v;
+            visibleCount += v;
+        }
+    }
+#endif
+
+    for (; b < count; ++b) {
+        bool inside = true;
+        for (int i = 0; i < PlaneCount && inside; ++i) {
+            const Plane& p = m_planes[i];
+            inside = p.d + p.a * px[i][b] + p.b * py[i][b] + p.c * pz[i][b] >= 0.0f;
+        }
+        visible[b] = inside ? 1 : 0;
+        visibleCount += inside ? 1 : 0;
+    }
+    return visibleCount;
+}
+
+const char* Frustum::cullKernelName() {
+#if defined(BRICKWORLDS_FRUSTUM_SSE)
+    return "sse";
+#else
+    return "scalar";
+#endif
+}
+
+} // namespace Core
+} // namespace BrickWorlds
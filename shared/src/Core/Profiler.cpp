@@ -0,0 +1,125 @@
+#include "BrickWorlds/Core/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+
+namespace BrickWorlds {
+namespace Core {
+
+namespace {
+
+constexpr std::size_t kStageCount = static_cast<std::size_t>(ProfileStage::Count);
+
+// Single writer (the owning thread), readers only in report(). Atomics so a report
+// during recording reads stale values instead of racing.
+struct ThreadRings {
+    std::atomic<std::uint64_t> written[kStageCount];
+    std::atomic<std::uint64_t> samples[kStageCount][Profiler::RingSize];
+};
+
+std::mutex g_registryMutex;
+// Keeps the rings of finished threads (e.g. stopped workers) for the report
+std::vector<std::shared_ptr<ThreadRings>> g_registry;
+
+ThreadRings& localRings() {
+    thread_local const std::shared_ptr<ThreadRings> rings = [] {
+        auto r = std::make_shared<ThreadRings>();   // value-initialised: all zero
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        g_registry.push_back(r);
+        return r;
+    }();
+    return *rings;
+}
+
+double percentile(const std::vector<std::uint64_t>& sorted, double p) {
+    // nearest rank, in microseconds
+    const auto rank = static_cast<std::size_t>(std::ceil(p * static_cast<double>(sorted.size())));
+    return static_cast<double>(sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1]) / 1000.0;
+}
+
+} // namespace
+
+const char* profileStageName(ProfileStage stage) {
+    switch (stage) {
+    case ProfileStage::Frame: return "frame";
+    case ProfileStage::UpdateStreaming: return "updateStreaming";
+    case ProfileStage::UploadMeshes: return "uploadMeshes";
+    case ProfileStage::CullChunks: return "cullChunks";
+    case ProfileStage::DrawSubmit: return "drawSubmit";
+    case ProfileStage::ServerTick: return "serverTick";
+    case ProfileStage::GenerateChunk: return "generateChunk";
+    case ProfileStage::MeshChunk: return "meshChunk";
+    default: return "unknown";
+    }
+}
+
+void Profiler::record(ProfileStage stage, std::uint64_t nanoseconds) {
+    ThreadRings& rings = localRings();
+    const auto s = static_cast<std::size_t>(stage);
+    const std::uint64_t n = rings.written[s].load(std::memory_order_relaxed);
+    rings.samples[s][n % RingSize].store(nanoseconds, std::memory_order_relaxed);
+    rings.written[s].store(n + 1, std::memory_order_release);
+}
+
+std::vector<ProfileStageReport> Profiler::report() {
+    std::vector<std::shared_ptr<ThreadRings>> registry;
+    {
+        std::lock_guard<std::mutex> lock(g_registryMutex);
+        registry = g_registry;
+    }
+
+    std::vector<ProfileStageReport> result;
+    std::vector<std::uint64_t> values;
+    for (std::size_t s = 0; s < kStageCount; ++s) {
+        values.clear();
+        for (const auto& rings : registry) {
+            const std::uint64_t n = rings->written[s].load(std::memory_order_acquire);
+            const std::uint64_t kept = std::min<std::uint64_t>(n, RingSize);
+            for (std::uint64_t i = n - kept; i < n; ++i)
+                values.push_back(rings->samples[s][i % RingSize].load(std::memory_order_relaxed));
+        }
+        if (values.empty()) continue;
+        std::sort(values.begin(), values.end());
+
+        ProfileStageReport r;
+        r.stage = static_cast<ProfileStage>(s);
+        r.samples = values.size();
+        double sum = 0.0;
+        for (std::uint64_t v : values) sum += static_cast<double>(v);
+        r.meanUs = sum / static_cast<double>(values.size()) / 1000.0;
+        r.p50Us = percentile(values, 0.50);
+        r.p95Us = percentile(values, 0.95);
+        r.p99Us = percentile(values, 0.99);
+        r.maxUs = static_cast<double>(values.back()) / 1000.0;
+        result.push_back(r);
+    }
+    return result;
+}
+
+void Profiler::printReport(std::FILE* out) {
+    std::fprintf(out, "%-16s %8s %10s %10s %10s %10s %10s\n", "stage", "samples", "mean us", "p50 us", "p95 us",
+        "p99 us", "max us");
+    for (const ProfileStageReport& r : report()) {
+        std::fprintf(out, "%-16s %8zu %10.1f %10.1f %10.1f %10.1f %10.1f\n", profileStageName(r.stage), r.samples,
+            r.meanUs, r.p50Us, r.p95Us, r.p99Us, r.maxUs);
+    }
+}
+
+void Profiler::writeJson(std::FILE* out) {
+    const std::vector<ProfileStageReport> stages = report();
+    std::fprintf(out, "{\n  \"ringSize\": %zu,\n  \"stages\": [\n", RingSize);
+    for (std::size_t i = 0; i < stages.size(); ++i) {
+        const ProfileStageReport& r = stages[i];
+        std::fprintf(out,
+            "    { \"stage\": \"%s\", \"samples\": %zu, \"meanUs\": %.2f, \"p50Us\": %.2f, \"p95Us\": %.2f, "
+            "\"p99Us\": %.2f, \"maxUs\": %.2f }%s\n",
+            profileStageName(r.stage), r.samples, r.meanUs, r.p50Us, r.p95Us, r.p99Us, r.maxUs,
+            i + 1 < stages.size() ? "," : "");
+    }
+    std::fprintf(out, "  ]\n}\n");
+}
+
+} // namespace Core
+} // namespace BrickWorlds
@@ -0,0 +1,87 @@
+#include "BrickWorlds/Core/UploadScheduler.h"
+
+#include <algorithm>
+
+namespace BrickWorlds {
+namespace Core {
+
+namespace {
+
+// Share of the frame headroom (or overrun) applied to the budget per frame
+constexpr double kBudgetGain = 0.25;
+// Weight of older upload samples per new sample (~ last 64 uploads)
+constexpr double kDecay = 63.0 / 64.0;
+// Cost model before the first measurements
+constexpr double kDefaultOverheadUs = 20.0;
+constexpr double kDefaultNsPerByte = 0.5;
+
+} // namespace
+
+UploadScheduler::UploadScheduler() : UploadScheduler(Settings{}) {}
+
+UploadScheduler::UploadScheduler(const Settings& settings) {
+    setSettings(settings);
+    m_stats.overheadUs = kDefaultOverheadUs;
+    m_stats.nsPerByte = kDefaultNsPerByte;
+}
+
+void UploadScheduler::setSettings(const Settings& settings) {
+    m_settings = settings;
+    m_settings.maxBudgetUs = std::max(m_settings.maxBudgetUs, m_settings.minBudgetUs);
+    m_budgetUs = std::clamp(m_settings.initialBudgetUs, m_settings.minBudgetUs, m_settings.maxBudgetUs);
+    m_stats.budgetUs = m_budgetUs;
+}
+
+void UploadScheduler::beginFrame(double lastFrameWorkMs) {
+    if (lastFrameWorkMs > 0.0) {
+        // Proportional controller: spend part of the headroom, give back part of an overrun.
+        // Only grow while the budget actually limited uploads, otherwise idle frames
+        // would wind it up to the maximum and the next burst overshoots.
+        const double headroomUs = (m_settings.targetFrameMs - lastFrameWorkMs) * 1000.0;
+        if (headroomUs < 0.0 || m_stats.deferred > 0)
+            m_budgetUs = std::clamp(m_budgetUs + kBudgetGain * headroomUs, m_settings.minBudgetUs, m_settings.maxBudgetUs);
+        m_stats.lastFrameMs = lastFrameWorkMs;
+    }
+
+    m_stats.budgetUs = m_budgetUs;
+    m_stats.spentUs = 0.0;
+    m_stats.bytes = 0;
+    m_stats.uploads = 0;
+    m_stats.deferred = 0;
+}
+
+double UploadScheduler::estimateUs(std::size_t bytes) const {
+    return m_stats.overheadUs + static_cast<double>(bytes) * m_stats.nsPerByte / 1000.0;
+}
+
+bool UploadScheduler::canUpload(std::size_t bytes) const {
+    if (m_stats.uploads == 0) return true;
+    if (m_stats.bytes + bytes > m_settings.maxBytesPerFrame) return false;
+    return m_stats.spentUs + estimateUs(bytes) <= m_budgetUs;
+}
+
+void UploadScheduler::recordUpload(std::size_t bytes, double microseconds) {
+    ++m_stats.uploads;
+    m_stats.bytes += bytes;
+    m_stats.spentUs += microseconds;
+
+    const double x = static_cast<double>(bytes);
+    m_sumW = m_sumW * kDecay + 1.0;
+    m_sumX = m_sumX * kDecay + x;
+    m_sumY = m_sumY * kDecay + microseconds;
+    m_sumXX = m_sumXX * kDecay + x * x;
+    m_sumXY = m_sumXY * kDecay + x * microseconds;
+
+    // Least squares fit; all samples (nearly) the same size -> cost proportional to bytes
+    const double denom = m_sumW * m_sumXX - m_sumX * m_sumX;
+    double slope = 0.0;
+    if (denom > 1e-6 * m_sumW * m_sumXX) slope = (m_sumW * m_sumXY - m_sumX * m_sumY) / denom;
+    else if (m_sumX > 0.0) slope = m_sumY / m_sumX;
+    slope = std::max(slope, 0.0);
+
+    m_stats.nsPerByte = slope * 1000.0;
+    m_stats.overheadUs = std::max((m_sumY - slope * m_sumX) / m_sumW, 0.0);
+}
+
+} // namespace Core
+} // namespace BrickWorlds
@@ -0,0 +1,136 @@
+#include "BrickWorlds/Voxel/BlockStorage.h"
+
+namespace BrickWorlds::Voxel {
+
+    static std::size_t WordCount(int size, int bits) {
+        const int perWord = 64 / bits;
+        return static_cast<std::size_t>((size + perWord - 1) / perWord);
+    }
+
+    BlockStorage::BlockStorage(int size, BlockId fill)
+        : size_(size) {
+        Fill(fill);
+    }
+
+    int BlockStorage::BitsForPalette(std::size_t paletteSize) {
+        if (paletteSize <= 2) return 1;
+        if (paletteSize <= 4) return 2;
+        if (paletteSize <= 16) return 4;
+        if (paletteSize <= 256) return 8;
+        return 16;
+    }
+
+    void BlockStorage::Fill(BlockId id) {
+        // assign() behaelt die Kapazitaet
+        bits_ = 1;
+        palette_.assign(1, id);
+        words_.assign(WordCount(size_, bits_), 0);
+    }
+
+    void BlockStorage::GetRange(int index, int count, BlockId* out) const {
+        // Bitbreiten sind Zweierpotenzen: kein Eintrag liegt ueber einer Wortgrenze
+        const int perWord = 64 / bits_;
+        const std::uint64_t mask = (1ull << bits_) - 1;
+        std::size_t w = static_cast<std::size_t>(index / perWord);
+        int slot = index % perWord;
+        std::uint64_t word = words_[w] >> (slot * bits_);
+
+        for (int i = 0; i < count; ++i, ++slot, word >>= bits_) {
+            if (slot == perWord) {
+                word = words_[++w];
+                slot = 0;
+            }
+            const std::uint32_t raw = static_cast<std::uint32_t>(word & mask);
+            out[i] = (bits_ == 16) ? static_cast<BlockId>(raw) : palette_[raw];
+        }
+    }
+
+    void BlockStorage::Set(int index, BlockId id) {
+        if (bits_ == 16) {
+            WriteRaw(index, id);
+            return;
+        }
+        WriteRaw(index, PaletteIndexOf(id));
+    }
+
+    void BlockStorage::WriteRaw(int index, std::uint32_t value) {
+        const int perWord = 64 / bits_;
+        std::uint64_t& word = words_[static_cast<std::size_t>(index / perWord)];
+        const int shift = (index % perWord) * bits_;
+        const std::uint64_t mask = ((1ull << bits_) - 1) << shift;
+        word = (word & ~mask) | (static_cast<std::uint64_t>(value) << shift);
+    }
+
+    std::uint32_t BlockStorage::PaletteIndexOf(BlockId id) {
+        for (std::size_t i = 0; i < palette_.size(); ++i) {
+            if (palette_[i] == id) return static_cast<std::uint32_t>(i);
+        }
+
+        if (palette_.size() < (std::size_t{ 1 } << bits_)) {
+            palette_.push_back(id);
+            return static_cast<std::uint32_t>(palette_.size() - 1);
+        }
+
+        if (bits_ < 8) {
+            // Palette voll: Bitbreite verdoppeln, Indizes bleiben gleich
+            std::vector<std::uint16_t> identity(palette_.size());
+            for (std::size_t i = 0; i < identity.size(); ++i) identity[i] = static_cast<std::uint16_t>(i);
+            Repack(bits_ * 2, identity);
+            palette_.push_back(id);
+            return static_cast<std::uint32_t>(palette_.size() - 1);
+        }
+
+        // Mehr als 256 Ids: Palette aufloesen, direkt 16 Bit speichern
+        std::vector<std::uint16_t> toIds(palette_.begin(), palette_.end());
+        Repack(16, toIds);
+        palette_.clear();
+        return id;
+    }
+
+    void BlockStorage::Repack(int newBits, const std::vector<std::uint16_t>& remap) {
+        std::vector<std::uint64_t> old;
+        old.swap(words_);
+        words_.assign(WordCount(size_, newBits), 0);
+
+        const int oldBits = bits_;
+        const int oldPerWord = 64 / oldBits;
+        const int newPerWord = 64 / newBits;
+        const std::uint64_t oldMask = (1ull << oldBits) - 1;
+
+        for (int i = 0; i < size_; ++i) {
+            const std::uint64_t raw = (old[static_cast<std::size_t>(i / oldPerWord)] >> ((i % oldPerWord) * oldBits)) & oldMask;
+            words_[static_cast<std::size_t>(i / newPerWord)] |=
+                static_cast<std::uint64_t>(remap[static_cast<std::size_t>(raw)]) << ((i % newPerWord) * newBits);
+        }
+        bits_ = newBits;
+    }
+
+    void BlockStorage::Compact() {
+        const std::size_t rawRange = (bits_ == 16) ? 65536u : palette_.size();
+
+        std::vector<std::uint8_t> used(rawRange, 0);
+        for (int i = 0; i < size_; ++i) used[ReadRaw(i)] = 1;
+
+        std::vector<BlockId> newPalette;
+        std::vector<std::uint16_t> remap(rawRange, 0);
+        for (std::size_t r = 0; r < rawRange; ++r) {
+            if (!used[r]) continue;
+            remap[r] = static_cast<std::uint16_t>(newPalette.size());
+            newPalette.push_back((bits_ == 16) ? static_cast<BlockId>(r) : palette_[r]);
+        }
+
+        const int newBits = BitsForPalette(newPalette.size());
+        if (newBits == 16) return; // bleibt direkt gespeichert
+        if (newBits == bits_ && newPalette.size() == palette_.size()) return;
+
+        Repack(newBits, remap);
+        palette_ = std::move(newPalette);
+    }
+
+    std::size_t BlockStorage::MemoryUsage() const {
+        return sizeof(*this)
+            + palette_.capacity() * sizeof(BlockId)
+            + words_.capacity() * sizeof(std::uint64_t);
+    }
+
+} // namespace BrickWorlds::Voxel
@@ -1,22 +1,77 @@
 #include "BrickWorlds/Voxel/Chunk.h"
 
+#include <utility>
+
 namespace BrickWorlds::Voxel {
 
     Chunk::Chunk(ChunkKey key)
         : key_(key),
-        blocks_(ChunkVolume, BlockId{ Air }) {
+        published_(std::make_shared<const ChunkBlocks>()) {
+        MarkDirtyMesh();
     }
 
-    BlockId Chunk::Get(int lx, int ly, int lz) const {
+    void Chunk::Reset(ChunkKey key) {
         std::scoped_lock lk(mtx_);
-        return blocks_[Index(lx, ly, lz)];
+        key_ = key;
+
+        // erst den alten Schnappschuss loslassen, damit dessen Sections als Reserve taugen
+        std::atomic_store(&published_, std::make_shared<const ChunkBlocks>());
+        blocks_.Reset();
+        {
+            std::scoped_lock meshLk(meshMtx_);
+            mesh_.Clear();
+        }
+
+        state_.store(ChunkState::Empty, std::memory_order_relaxed);
+        dirtyBlocks_.store(true, std::memory_order_relaxed);
+        for (auto& w : dirtyMesh_) w.store(0, std::memory_order_relaxed);
+        MarkDirtyMesh();
+        missingNeighbors_.store(0, std::memory_order_relaxed);
+        lod_.store(0, std::memory_order_relaxed);
+    }
+
+    BlockId Chunk::Get(int lx, int ly, int lz) const {
+        return View().Get(lx, ly, lz);
+    }
+
+    int Chunk::Height(int lx, int lz) const {
+        return View().Height(lx, lz);
     }
 
     void Chunk::Set(int lx, int ly, int lz, BlockId id) {
         std::scoped_lock lk(mtx_);
-        blocks_[Index(lx, ly, lz)] = id;
+        blocks_.Set(Index(lx, ly, lz), id);   // fuehrt auch die Hoehenkarte nach
+        PublishUnsafe();
         dirtyBlocks_.store(true, std::memory_order_relaxed);
-        dirtyMesh_.store(true, std::memory_order_relaxed);
+        // Nachbar-Chunks an der Kante markiert World
+        MarkDirtyMesh(MeshDirtyMask::ForRows(ly, ly));
+    }
+
+    void Chunk::SwapMesh(ChunkMeshData& mesh) {
+        std::scoped_lock lk(meshMtx_);
+        mesh_.vertices.swap(mesh.vertices);
+        std::swap(mesh_.bucketStart, mesh.bucketStart);
+        std::swap(mesh_.connectivity, mesh.connectivity);
+    }
+
+    void Chunk::PublishUnsafe() {
+        // Kopie teilt sich die Section-Speicher; nur die Section-Tabelle wird kopiert
+        std::atomic_store(&published_, std::shared_ptr<const ChunkBlocks>(std::make_shared<ChunkBlocks>(blocks_)));
+    }
+
+    bool Chunk::IsSectionUniform(int sy) const {
+        return View().IsSectionUniform(sy);
+    }
+
+    BlockId Chunk::SectionId(int sy) const {
+        return View().SectionId(sy);
+    }
+
+    std::size_t Chunk::MemoryUsage() const {
+        std::scoped_lock lk(mtx_, meshMtx_);
+        return sizeof(*this) - sizeof(ChunkBlocks)
+            + blocks_.MemoryUsage()
+            + mesh_.vertices.capacity() * sizeof(PackedVertex);
     }
 
 } // namespace BrickWorlds::Voxel
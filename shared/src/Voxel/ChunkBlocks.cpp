@@ -0,0 +1,196 @@
+#include "BrickWorlds/Voxel/ChunkBlocks.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace BrickWorlds::Voxel {
+
+    // Invariante fuer die use_count()-Abfragen: Section-Speicher werden nur durch Kopieren
+    // eines ChunkBlocks geteilt, und das passiert ausschliesslich beim Publish unter dem
+    // Chunk-Mutex. Leser kopieren nur den shared_ptr auf den Schnappschuss, nie die
+    // Section-Zeiger. Andere Threads koennen den Zaehler also nur senken (alter
+    // Schnappschuss wird freigegeben), nie erhoehen:
+    //  - ein veralteter Wert > 1 kostet hoechstens eine unnoetige Kopie,
+    //  - ein Wert == 1 heisst: nur diese Instanz haelt den Speicher, und das bleibt so.
+    // Wer einen ChunkBlocks ausserhalb des Schreibers kopiert, bricht diese Invariante.
+    static bool IsExclusive(const std::shared_ptr<BlockStorage>& data) {
+        if (data.use_count() != 1) return false;
+        // use_count() liest relaxed: Lesezugriffe des Threads, der die letzte fremde
+        // Referenz (release) freigegeben hat, muessen vor unserem Schreiben liegen
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return true;
+    }
+
+    BlockStorage& ChunkBlocks::MakeUnique(std::shared_ptr<BlockStorage>& data) {
+        if (!IsExclusive(data)) data = std::make_shared<BlockStorage>(*data);
+        return *data;
+    }
+
+    std::shared_ptr<BlockStorage> ChunkBlocks::NewSection(BlockId fill) {
+        if (spares_.empty()) return std::make_shared<BlockStorage>(SectionVolume, fill);
+
+        auto data = std::move(spares_.back());
+        spares_.pop_back();
+        data->Fill(fill);
+        return data;
+    }
+
+    void ChunkBlocks::Set(int index, BlockId id) {
+        Section& s = sections_[static_cast<std::size_t>(index / SectionVolume)];
+        if (!s.data) {
+            if (s.uniformId == id) return;
+            // erste abweichende Schreiboperation: Section materialisieren
+            s.data = NewSection(s.uniformId);
+        }
+        MakeUnique(s.data).Set(index % SectionVolume, id);
+        UpdateHeight(index, id);
+    }
+
+    void ChunkBlocks::UpdateHeight(int index, BlockId id) {
+        constexpr int ColumnCount = ChunkX * ChunkZ;
+        const int column = index % ColumnCount;
+        const int y = index / ColumnCount;
+        std::int16_t& h = heights_[static_cast<std::size_t>(column)];
+
+        if (id != Air) {
+            if (y > h) h = static_cast<std::int16_t>(y);
+            minY_ = std::min(minY_, y);
+            maxY_ = std::max(maxY_, y);
+            return;
+        }
+        if (y != h) return;
+
+        // oberster Block abgebaut: naechsten darunter suchen
+        h = static_cast<std::int16_t>(ScanDown(column, y - 1));
+        if (y == maxY_) UpdateMaxY();
+    }
+
+    int ChunkBlocks::ScanDown(int column, int fromY) const {
+        constexpr int ColumnCount = ChunkX * ChunkZ;
+        for (int y = fromY; y >= 0;) {
+            const int sy = y / SectionY;
+            const Section& s = sections_[static_cast<std::size_t>(sy)];
+            if (!s.data) {
+                if (s.uniformId != Air) return y;
+                y = sy * SectionY - 1;
+                continue;
+            }
+            for (const int y0 = sy * SectionY; y >= y0; --y) {
+                if (s.data->Get((y - y0) * ColumnCount + column) != Air) return y;
+            }
+        }
+        return -1;
+    }
+
+    void ChunkBlocks::UpdateMaxY() {
+        maxY_ = *std::max_element(heights_.begin(), heights_.end());
+        if (maxY_ < 0) minY_ = ChunkY;
+    }
+
+    void ChunkBlocks::RecomputeHeights() {
+        constexpr int ColumnCount = ChunkX * ChunkZ;
+        heights_.fill(-1);
+        minY_ = ChunkY;
+        maxY_ = -1;
+
+        // Von oben: jede Spalte bekommt den ersten Treffer
+        BlockId row[ColumnCount];
+        int open = ColumnCount;
+        for (int sy = SectionCount - 1; sy >= 0 && open > 0; --sy) {
+            const Section& s = sections_[static_cast<std::size_t>(sy)];
+            if (!s.data) {
+                if (s.uniformId == Air) continue;
+                for (auto& h : heights_) if (h < 0) h = static_cast<std::int16_t>(sy * SectionY + SectionY - 1);
+                break;
+            }
+            for (int y = SectionY - 1; y >= 0 && open > 0; --y) {
+                s.data->GetRange(y * ColumnCount, ColumnCount, row);
+                for (int c = 0; c < ColumnCount; ++c) {
+                    if (heights_[static_cast<std::size_t>(c)] >= 0 || row[c] == Air) continue;
+                    heights_[static_cast<std::size_t>(c)] = static_cast<std::int16_t>(sy * SectionY + y);
+                    --open;
+                }
+            }
+        }
+        UpdateMaxY();
+        if (maxY_ < 0) return;
+
+        // Von unten: erste Zeile mit einem Block
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            const Section& s = sections_[static_cast<std::size_t>(sy)];
+            if (!s.data) {
+                if (s.uniformId == Air) continue;
+                minY_ = sy * SectionY;
+                return;
+            }
+            for (int y = 0; y < SectionY; ++y) {
+                s.data->GetRange(y * ColumnCount, ColumnCount, row);
+                if (std::any_of(row, row + ColumnCount, [](BlockId id) { return id != Air; })) {
+                    minY_ = sy * SectionY + y;
+                    return;
+                }
+            }
+        }
+    }
+
+    void ChunkBlocks::Fill(BlockId id) {
+        for (int sy = 0; sy < SectionCount; ++sy) FillSection(sy, id);
+    }
+
+    void ChunkBlocks::FillSection(int sy, BlockId id) {
+        Section& s = sections_[static_cast<std::size_t>(sy)];
+        s.uniformId = id;
+        s.data.reset();
+
+        const int y0 = sy * SectionY;
+        const int y1 = y0 + SectionY - 1;
+        if (id != Air) {
+            for (auto& h : heights_) h = std::max(h, static_cast<std::int16_t>(y1));
+            minY_ = std::min(minY_, y0);
+            maxY_ = std::max(maxY_, y1);
+            return;
+        }
+
+        // Spalten, deren oberster Block in der Section lag, fallen darunter
+        for (int c = 0; c < ChunkX * ChunkZ; ++c) {
+            std::int16_t& h = heights_[static_cast<std::size_t>(c)];
+            if (h >= y0 && h <= y1) h = static_cast<std::int16_t>(ScanDown(c, y0 - 1));
+        }
+        if (maxY_ >= y0 && maxY_ <= y1) UpdateMaxY();
+    }
+
+    void ChunkBlocks::Compact() {
+        for (auto& s : sections_) {
+            if (!s.data) continue;
+            MakeUnique(s.data).Compact();
+            if (s.data->PaletteSize() == 1) {
+                s.uniformId = s.data->Get(0);
+                s.data.reset();
+            }
+        }
+    }
+
+    void ChunkBlocks::Reset() {
+        for (auto& s : sections_) {
+            // noch von einem Schnappschuss referenzierte Speicher nicht wiederverwenden
+            if (s.data && spares_.size() < SectionCount && IsExclusive(s.data)) {
+                spares_.push_back(std::move(s.data));
+            }
+            s.data.reset();
+            s.uniformId = Air;
+        }
+        heights_.fill(-1);
+        minY_ = ChunkY;
+        maxY_ = -1;
+    }
+
+    std::size_t ChunkBlocks::MemoryUsage() const {
+        std::size_t bytes = sizeof(*this);
+        for (const auto& s : sections_) {
+            if (s.data) bytes += s.data->MemoryUsage();
+        }
+        for (const auto& spare : spares_) bytes += spare->MemoryUsage();
+        return bytes + spares_.capacity() * sizeof(spares_[0]);
+    }
+
+} // namespace BrickWorlds::Voxel
@@ -1,36 +1,120 @@
 #include "BrickWorlds/Voxel/ChunkManager.h"
 
+#include <mutex>
+
 namespace BrickWorlds::Voxel {
 
+    class ChunkPool : public std::enable_shared_from_this<ChunkPool> {
+    public:
+        explicit ChunkPool(std::size_t capacity)
+            : capacity_(capacity) {
+        }
+
+        std::shared_ptr<Chunk> Acquire(const ChunkKey& key) {
+            std::unique_ptr<Chunk> chunk;
+            {
+                std::scoped_lock lk(mtx_);
+                if (free_.empty()) {
+                    ++stats_.misses;
+                }
+                else {
+                    chunk = std::move(free_.back());
+                    free_.pop_back();
+                    ++stats_.hits;
+                    stats_.pooled = free_.size();
+                    stats_.residentBytes -= chunk->MemoryUsage();
+                }
+            }
+
+            if (chunk) chunk->Reset(key);
+            else chunk = std::make_unique<Chunk>(key);
+            return std::shared_ptr<Chunk>(chunk.release(), Recycler{ weak_from_this() });
+        }
+
+        void SetCapacity(std::size_t capacity) {
+            std::vector<std::unique_ptr<Chunk>> released;
+            std::scoped_lock lk(mtx_);
+            capacity_ = capacity;
+            while (free_.size() > capacity_) {
+                stats_.residentBytes -= free_.back()->MemoryUsage();
+                released.push_back(std::move(free_.back()));
+                free_.pop_back();
+            }
+            stats_.pooled = free_.size();
+        }
+
+        ChunkPoolStats Stats() const {
+            std::scoped_lock lk(mtx_);
+            return stats_;
+        }
+
+    private:
+        // Deleter der ausgegebenen shared_ptr: letzte Referenz weg -> zurueck in den Pool
+        struct Recycler {
+            std::weak_ptr<ChunkPool> pool;
+
+            void operator()(Chunk* chunk) const {
+                std::unique_ptr<Chunk> owned(chunk);
+                if (auto p = pool.lock()) p->Release(std::move(owned));
+            }
+        };
+
+        void Release(std::unique_ptr<Chunk> chunk) {
+            // unreferenziert -> Reset ohne Konkurrenz, ausserhalb des Pool-Locks
+            chunk->Reset(chunk->Key());
+            const std::size_t bytes = chunk->MemoryUsage();
+
+            std::scoped_lock lk(mtx_);
+            if (free_.size() >= capacity_) {
+                ++stats_.dropped;
+                return;
+            }
+            free_.push_back(std::move(chunk));
+            ++stats_.recycled;
+            stats_.pooled = free_.size();
+            stats_.residentBytes += bytes;
+        }
+
+        mutable std::mutex mtx_;
+        std::vector<std::unique_ptr<Chunk>> free_;
+        std::size_t capacity_;
+        ChunkPoolStats stats_;
+    };
+
+    ChunkManager::ChunkManager(std::size_t poolCapacity)
+        : pool_(std::make_shared<ChunkPool>(poolCapacity)) {
+    }
+
+    ChunkManager::~ChunkManager() = default;
+
     std::shared_ptr<Chunk> ChunkManager::GetChunk(const ChunkKey& key) const {
-        std::shared_lock lk(mtx_);
-        auto it = chunks_.find(key);
-        return (it != chunks_.end()) ? it->second : nullptr;
+        return chunks_.Find(key);
     }
 
     std::shared_ptr<Chunk> ChunkManager::GetOrCreate(const ChunkKey& key) {
-        {
-            std::shared_lock lk(mtx_);
-            auto it = chunks_.find(key);
-            if (it != chunks_.end()) return it->second;
-        }
-        std::unique_lock lk(mtx_);
-        auto& ref = chunks_[key];
-        if (!ref) ref = std::make_shared<Chunk>(key);
-        return ref;
+        if (auto existing = chunks_.Find(key)) return existing;
+
+        // ausserhalb des Shard-Locks vorbereiten; verliert das Rennen -> zurueck in den Pool
+        return chunks_.Insert(key, pool_->Acquire(key));
     }
 
     void ChunkManager::Remove(const ChunkKey& key) {
-        std::unique_lock lk(mtx_);
-        chunks_.erase(key);
+        // Freigabe (und damit Recycling) ausserhalb des Shard-Locks
+        std::shared_ptr<Chunk> removed = chunks_.Erase(key);
     }
 
     std::vector<std::shared_ptr<Chunk>> ChunkManager::SnapshotAll() const {
-        std::shared_lock lk(mtx_);
         std::vector<std::shared_ptr<Chunk>> out;
-        out.reserve(chunks_.size());
-        for (auto& kv : chunks_) out.push_back(kv.second);
+        chunks_.Snapshot(out);
         return out;
     }
 
+    void ChunkManager::SetPoolCapacity(std::size_t capacity) {
+        pool_->SetCapacity(capacity);
+    }
+
+    ChunkPoolStats ChunkManager::PoolStats() const {
+        return pool_->Stats();
+    }
+
 } // namespace BrickWorlds::Voxel
@@ -0,0 +1,110 @@
+#include "BrickWorlds/Voxel/ChunkMap.h"
+
+#include <mutex>
+#include <utility>
+
+namespace BrickWorlds::Voxel {
+
+    static constexpr std::size_t InitialShardCapacity = 64;
+
+    ChunkMap::ChunkMap() {
+        for (auto& shard : shards_) shard.slots.resize(InitialShardCapacity);
+    }
+
+    std::ptrdiff_t ChunkMap::FindSlot(const Shard& shard, const ChunkKey& key, std::uint64_t hash) {
+        const std::size_t mask = shard.slots.size() - 1;
+        for (std::size_t i = hash & mask, probes = 0; probes < shard.slots.size(); i = (i + 1) & mask, ++probes) {
+            const Slot& s = shard.slots[i];
+            if (s.state == SlotState::Empty) return -1;
+            if (s.state == SlotState::Full && s.key == key) return static_cast<std::ptrdiff_t>(i);
+        }
+        return -1;
+    }
+
+    void ChunkMap::Rehash(Shard& shard, std::size_t newCapacity) {
+        std::vector<Slot> old(newCapacity);
+        old.swap(shard.slots);
+        shard.deleted = 0;
+
+        const std::size_t mask = newCapacity - 1;
+        for (auto& s : old) {
+            if (s.state != SlotState::Full) continue;
+            std::size_t i = Hash(s.key) & mask;
+            while (shard.slots[i].state == SlotState::Full) i = (i + 1) & mask;
+            shard.slots[i] = std::move(s);
+        }
+    }
+
+    std::shared_ptr<Chunk> ChunkMap::Find(const ChunkKey& key) const {
+        const std::uint64_t hash = Hash(key);
+        const Shard& shard = ShardFor(hash);
+
+        std::shared_lock lk(shard.mtx);
+        const std::ptrdiff_t i = FindSlot(shard, key, hash);
+        return (i >= 0) ? shard.slots[static_cast<std::size_t>(i)].value : nullptr;
+    }
+
+    std::shared_ptr<Chunk> ChunkMap::Insert(const ChunkKey& key, std::shared_ptr<Chunk> value) {
+        const std::uint64_t hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        std::unique_lock lk(shard.mtx);
+        const std::ptrdiff_t existing = FindSlot(shard, key, hash);
+        if (existing >= 0) return shard.slots[static_cast<std::size_t>(existing)].value;
+
+        // Lastfaktor inkl. Grabsteinen unter 70% halten
+        if ((shard.size + shard.deleted + 1) * 10 > shard.slots.size() * 7) {
+            const bool grow = (shard.size + 1) * 10 > shard.slots.size() * 5;
+            Rehash(shard, grow ? shard.slots.size() * 2 : shard.slots.size());
+        }
+
+        const std::size_t mask = shard.slots.size() - 1;
+        std::size_t i = hash & mask;
+        while (shard.slots[i].state == SlotState::Full) i = (i + 1) & mask;
+
+        Slot& slot = shard.slots[i];
+        if (slot.state == SlotState::Deleted) --shard.deleted;
+        slot.key = key;
+        slot.state = SlotState::Full;
+        slot.value = std::move(value);
+        ++shard.size;
+        return slot.value;
+    }
+
+    std::shared_ptr<Chunk> ChunkMap::Erase(const ChunkKey& key) {
+        const std::uint64_t hash = Hash(key);
+        Shard& shard = ShardFor(hash);
+
+        std::unique_lock lk(shard.mtx);
+        const std::ptrdiff_t i = FindSlot(shard, key, hash);
+        if (i < 0) return nullptr;
+
+        Slot& slot = shard.slots[static_cast<std::size_t>(i)];
+        std::shared_ptr<Chunk> removed = std::move(slot.value);
+        slot.value.reset();
+        slot.state = SlotState::Deleted;
+        --shard.size;
+        ++shard.deleted;
+        return removed;
+    }
+
+    void ChunkMap::Snapshot(std::vector<std::shared_ptr<Chunk>>& out) const {
+        out.reserve(out.size() + Size());
+        for (const auto& shard : shards_) {
+            std::shared_lock lk(shard.mtx);
+            for (const auto& s : shard.slots) {
+                if (s.state == SlotState::Full) out.push_back(s.value);
+            }
+        }
+    }
+
+    std::size_t ChunkMap::Size() const {
+        std::size_t n = 0;
+        for (const auto& shard : shards_) {
+            std::shared_lock lk(shard.mtx);
+            n += shard.size;
+        }
+        return n;
+    }
+
+} // namespace BrickWorlds::Voxel
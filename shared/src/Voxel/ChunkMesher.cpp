@@ -0,0 +1,278 @@
+#include "BrickWorlds/Voxel/ChunkMesher.h"
+#include "BrickWorlds/Voxel/SectionVisibility.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace BrickWorlds::Voxel {
+
+    namespace {
+
+        // Quad-Ecken relativ zum Block (gegen den Uhrzeigersinn von aussen)
+        // Reihenfolge: +Z, -Z, +Y, -Y, +X, -X
+        constexpr int FaceCorners[6][4][3] = {
+            { { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 } },   // +Z
+            { { 1, 0, 0 }, { 0, 0, 0 }, { 0, 1, 0 }, { 1, 1, 0 } },   // -Z
+            { { 0, 1, 1 }, { 1, 1, 1 }, { 1, 1, 0 }, { 0, 1, 0 } },   // +Y
+            { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 0, 1 }, { 0, 0, 1 } },   // -Y
+            { { 1, 0, 1 }, { 1, 0, 0 }, { 1, 1, 0 }, { 1, 1, 1 } },   // +X
+            { { 0, 0, 0 }, { 0, 0, 1 }, { 0, 1, 1 }, { 0, 1, 0 } },   // -X
+        };
+
+        constexpr int Dim[3] = { ChunkX, ChunkY, ChunkZ };
+
+        static_assert(64 % SectionY == 0, "Sections muessen in ein Maskenwort passen");
+
+        // Quad mit Ausdehnung (ex, ey, ez) Bloecke ab Chunk-lokal (x, y, z); naiv: 1x1x1
+        void AddQuad(int face, int x, int y, int z, int ex, int ey, int ez, BlockId id, ChunkMeshData& out) {
+            for (const auto& c : FaceCorners[face]) {
+                out.vertices.push_back(PackVertex(x + c[0] * ex, y + c[1] * ey, z + c[2] * ez, face, id));
+            }
+        }
+
+        // Pro Mesh-Worker wiederverwendet (~240 KB, zu gross fuer den Stack)
+        struct MeshScratch {
+            PaddedChunk padded;
+            std::unique_ptr<PaddedChunk> coarse;   // erst beim ersten LOD-Mesh angelegt
+            ChunkOccupancy occupancy;
+            ChunkFaceMasks faces;
+            // Greedy-Schicht: Id der sichtbaren Seite oder Air (max. 16x256).
+            // Ist nach jeder Schicht wieder komplett Air, da jedes Rechteck seine Eintraege loescht.
+            std::array<BlockId, ChunkX * ChunkY> mask;
+
+            MeshScratch() { mask.fill(Air); }
+        };
+
+        MeshScratch& Scratch() {
+            static thread_local MeshScratch scratch;
+            return scratch;
+        }
+
+        // Randspalten eines nicht geladenen Nachbarn: voll belegt -> keine Seiten zur Grenze hin
+        void FillSolid(int x0, int x1, int z0, int z1, ChunkOccupancy& occ) {
+            for (int lz = z0; lz < z1; ++lz)
+                for (int lx = x0; lx < x1; ++lx)
+                    for (auto& w : occ.At(lx, lz).w) w = ~std::uint64_t{ 0 };
+        }
+
+    } // namespace
+
+    void BuildOccupancy(const PaddedChunk& padded, ChunkOccupancy& out) {
+        out = ChunkOccupancy{};
+
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            if (padded.emptySection[sy] || !(padded.sections & (1u << sy))) continue;
+
+            // Zeilen ausserhalb des belegten Bereichs sind nicht kopiert (Air)
+            const int y1 = std::min((sy + 1) * SectionY - 1, padded.maxY);
+            for (int y = std::max(sy * SectionY, padded.minY); y <= y1; ++y) {
+                const int word = y >> 6;
+                const int bit = y & 63;
+                for (int lz = -1; lz <= ChunkZ; ++lz) {
+                    const BlockId* row = &padded.blocks[static_cast<std::size_t>(PaddedChunk::PaddedIndex(-1, y, lz))];
+                    ColumnMask* cols = &out.At(-1, lz);
+                    for (int i = 0; i < ChunkOccupancy::Width; ++i) {
+                        cols[i].w[word] |= static_cast<std::uint64_t>(row[i] != Air) << bit;
+                    }
+                }
+            }
+        }
+
+        // Rand fehlender Nachbarn wurde nicht kopiert -> solide
+        if (padded.missing & NeighborMinusX) FillSolid(-1, 0, 0, ChunkZ, out);
+        if (padded.missing & NeighborPlusX) FillSolid(ChunkX, ChunkX + 1, 0, ChunkZ, out);
+        if (padded.missing & NeighborMinusZ) FillSolid(0, ChunkX, -1, 0, out);
+        if (padded.missing & NeighborPlusZ) FillSolid(0, ChunkX, ChunkZ, ChunkZ + 1, out);
+    }
+
+    void BlockColor(BlockId id, float& r, float& g, float& b) {
+        switch (id) {
+            case Dirt:  r = 0.55f; g = 0.35f; b = 0.17f; break;
+            case Rock:  r = 0.50f; g = 0.50f; b = 0.50f; break;
+            case Water: r = 0.20f; g = 0.40f; b = 0.80f; break;
+            default:    r = 1.00f; g = 0.00f; b = 1.00f; break;
+        }
+    }
+
+    std::uint32_t ChunkMesher::RequiredSections(const MeshDirtyMask& dirty) {
+        // +Y/-Y-Seiten am Section-Rand haengen an der Nachbar-Section
+        const std::uint32_t s = dirty.Sections();
+        return (s | (s << 1) | (s >> 1)) & AllSections;
+    }
+
+    void ChunkMesher::Build(const MeshNeighborhood& n, ChunkMeshData& out) const {
+        PaddedChunk& padded = Scratch().padded;
+        CopyPadded(n, padded);
+        Build(padded, out);
+    }
+
+    void ChunkMesher::Build(const PaddedChunk& padded, ChunkMeshData& out) const {
+        static const ChunkMeshData none;
+        Update(padded, MeshDirtyMask::All(), none, out);
+    }
+
+    void ChunkMesher::BuildLod(const MeshNeighborhood& n, int lod, ChunkMeshData& out) const {
+        PaddedChunk& padded = Scratch().padded;
+        CopyPadded(n, padded);
+        BuildLod(padded, lod, out);
+    }
+
+    void ChunkMesher::BuildLod(const PaddedChunk& padded, int lod, ChunkMeshData& out) const {
+        if (lod <= 0) {
+            Build(padded, out);
+            return;
+        }
+
+        MeshScratch& scratch = Scratch();
+        if (!scratch.coarse) scratch.coarse = std::make_unique<PaddedChunk>();
+        DownsamplePadded(padded, std::min(lod, MaxLod), *scratch.coarse);
+        Build(*scratch.coarse, out);
+    }
+
+    void ChunkMesher::Update(const MeshNeighborhood& n, const MeshDirtyMask& dirty, const ChunkMeshData& previous, ChunkMeshData& out) const {
+        PaddedChunk& padded = Scratch().padded;
+        CopyPadded(n, padded, RequiredSections(dirty));
+        Update(padded, dirty, previous, out);
+    }
+
+    void ChunkMesher::Update(const PaddedChunk& padded, const MeshDirtyMask& dirty, const ChunkMeshData& previous, ChunkMeshData& out) const {
+        out.Clear();
+        out.vertices.reserve(previous.vertices.size());
+
+        MeshScratch& scratch = Scratch();
+        BuildOccupancy(padded, scratch.occupancy);
+        ComputeFaceMasks(scratch.occupancy, scratch.faces);
+
+        const std::uint32_t dirtySections = dirty.Sections();
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            if (!(dirtySections & (1u << sy))) out.connectivity[sy] = previous.connectivity[sy];
+            else if (padded.emptySection[sy]) out.connectivity[sy] = AllFacesConnected;
+            else out.connectivity[sy] = SectionConnectivity(scratch.occupancy, sy);
+        }
+
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            for (int face = 0; face < MeshFaceCount; ++face) {
+                const int b = MeshBucket(sy, face);
+                out.bucketStart[b] = static_cast<std::uint32_t>(out.vertices.size());
+
+                if (!dirty.Test(b)) {
+                    // unveraendert: Bucket aus dem alten Mesh uebernehmen
+                    out.vertices.insert(out.vertices.end(),
+                        previous.vertices.begin() + previous.bucketStart[b],
+                        previous.vertices.begin() + previous.bucketStart[b + 1]);
+                    continue;
+                }
+                if (padded.emptySection[sy]) continue;
+
+                if (mode_ == MeshMode::Greedy) BuildGreedy(padded, scratch.faces, sy, face, out);
+                else BuildNaive(padded, scratch.faces, sy, face, out);
+            }
+        }
+        out.bucketStart[MeshBucketCount] = static_cast<std::uint32_t>(out.vertices.size());
+    }
+
+    void ChunkMesher::BuildNaive(const PaddedChunk& padded, const ChunkFaceMasks& faces, int sy, int face, ChunkMeshData& out) const {
+        const int word = (sy * SectionY) >> 6;
+        const int shift = (sy * SectionY) & 63;
+        const std::uint64_t sectionBits = (std::uint64_t{ 1 } << SectionY) - 1;
+
+        for (int lz = 0; lz < ChunkZ; ++lz) {
+            for (int lx = 0; lx < ChunkX; ++lx) {
+                for (std::uint64_t bits = (faces.At(face, lx, lz).w[word] >> shift) & sectionBits; bits; bits &= bits - 1) {
+                    const int y = sy * SectionY + CountTrailingZeros64(bits);
+                    AddQuad(face, lx, y, lz, 1, 1, 1, padded.Get(lx, y, lz), out);
+                }
+            }
+        }
+    }
+
+    void ChunkMesher::BuildGreedy(const PaddedChunk& padded, const ChunkFaceMasks& faces, int sy, int face, ChunkMeshData& out) const {
+        auto& mask = Scratch().mask;
+
+        // d: Normalen-Achse, u/v: Achsen der Schicht (y immer als v, falls enthalten)
+        const int d = (face < 2) ? 2 : (face < 4) ? 1 : 0;
+        const int u = (d == 0) ? 2 : 0;
+        const int v = (d == 1) ? 2 : 1;
+        const int du = Dim[u];
+
+        const int y0 = sy * SectionY;
+        const int word = y0 >> 6;
+        const int shift = y0 & 63;
+        const std::uint64_t sectionBits = (std::uint64_t{ 1 } << SectionY) - 1;
+
+        // +Y/-Y: Schichten y0..y0+15, sonst Schichten entlang x bzw. z mit y auf die Section begrenzt
+        const int s0 = (d == 1) ? y0 : 0;
+        const int s1 = (d == 1) ? y0 + SectionY : Dim[d];
+
+        // Schichten ohne ein einziges gesetztes Bit ueberspringen
+        std::uint64_t anyY = 0;
+        if (d == 1) {
+            for (const ColumnMask& m : faces.faces[face]) anyY |= m.w[word] >> shift;
+            anyY &= sectionBits;
+            if (!anyY) return;
+        }
+
+        for (int s = s0; s < s1; ++s) {
+            // Maske aus den Seitenbits fuellen, belegte Zeilen [vMin, vMax] merken
+            int vMin = Dim[v], vMax = -1;
+            if (d == 1) {
+                if (!((anyY >> (s - y0)) & 1u)) continue;
+                for (int lz = 0; lz < ChunkZ; ++lz)
+                    for (int lx = 0; lx < ChunkX; ++lx) {
+                        if (!faces.At(face, lx, lz).Test(s)) continue;
+                        mask[static_cast<std::size_t>(lz) * du + lx] = padded.Get(lx, s, lz);
+                        vMin = std::min(vMin, lz);
+                        vMax = lz;
+                    }
+            }
+            else {
+                for (int iu = 0; iu < du; ++iu) {
+                    const int lx = (d == 0) ? s : iu;
+                    const int lz = (d == 0) ? iu : s;
+                    for (std::uint64_t bits = (faces.At(face, lx, lz).w[word] >> shift) & sectionBits; bits; bits &= bits - 1) {
+                        const int y = y0 + CountTrailingZeros64(bits);
+                        mask[static_cast<std::size_t>(y) * du + iu] = padded.Get(lx, y, lz);
+                        vMin = std::min(vMin, y);
+                        vMax = std::max(vMax, y);
+                    }
+                }
+            }
+            if (vMax < 0) continue;
+
+            // Maximale Rechtecke: erst entlang u, dann Zeilen entlang v anhaengen
+            for (int iv = vMin; iv <= vMax; ++iv) {
+                for (int iu = 0; iu < du;) {
+                    const BlockId id = mask[static_cast<std::size_t>(iv) * du + iu];
+                    if (id == Air) {
+                        ++iu;
+                        continue;
+                    }
+
+                    int w = 1;
+                    while (iu + w < du && mask[static_cast<std::size_t>(iv) * du + iu + w] == id) ++w;
+
+                    int h = 1;
+                    for (; iv + h <= vMax; ++h) {
+                        const BlockId* row = &mask[static_cast<std::size_t>(iv + h) * du + iu];
+                        int k = 0;
+                        while (k < w && row[k] == id) ++k;
+                        if (k < w) break;
+                    }
+
+                    for (int dy = 0; dy < h; ++dy) {
+                        BlockId* row = &mask[static_cast<std::size_t>(iv + dy) * du + iu];
+                        for (int k = 0; k < w; ++k) row[k] = Air;
+                    }
+
+                    int p[3], e[3];
+                    p[d] = s; p[u] = iu; p[v] = iv;
+                    e[d] = 1; e[u] = w; e[v] = h;
+                    AddQuad(face, p[0], p[1], p[2], e[0], e[1], e[2], id, out);
+                    iu += w;
+                }
+            }
+        }
+    }
+
+} // namespace BrickWorlds::Voxel
@@ -0,0 +1,59 @@
+#include "BrickWorlds/Voxel/DirtyChunkQueue.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace BrickWorlds::Voxel {
+
+    int DirtyChunkQueue::RingOf(const ChunkKey& key) const {
+        return std::max(std::abs(key.cx - center_.cx), std::abs(key.cz - center_.cz));
+    }
+
+    void DirtyChunkQueue::Insert(const ChunkKey& key) {
+        const auto ring = static_cast<std::size_t>(RingOf(key));
+        if (ring >= rings_.size()) rings_.resize(ring + 1);
+        rings_[ring].push_back(key);
+        firstRing_ = std::min(firstRing_, ring);
+    }
+
+    void DirtyChunkQueue::SetCenter(const ChunkKey& center) {
+        if (center == center_) return;
+        center_ = center;
+
+        // Ringe leeren, Kapazitaet behalten
+        for (auto& ring : rings_) ring.clear();
+        firstRing_ = rings_.size();
+        for (const ChunkKey& key : pending_) Insert(key);
+    }
+
+    void DirtyChunkQueue::Push(const ChunkKey& key) {
+        if (!pending_.insert(key).second) return;
+        Insert(key);
+    }
+
+    bool DirtyChunkQueue::Remove(const ChunkKey& key) {
+        // Eintrag im Ring bleibt liegen und wird beim Pop uebersprungen
+        return pending_.erase(key) != 0;
+    }
+
+    bool DirtyChunkQueue::TryPop(ChunkKey& out) {
+        for (; firstRing_ < rings_.size(); ++firstRing_) {
+            auto& ring = rings_[firstRing_];
+            while (!ring.empty()) {
+                const ChunkKey key = ring.back();
+                ring.pop_back();
+                if (pending_.erase(key) == 0) continue;   // verworfen oder schon entnommen
+                out = key;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void DirtyChunkQueue::Clear() {
+        for (auto& ring : rings_) ring.clear();
+        firstRing_ = rings_.size();
+        pending_.clear();
+    }
+
+} // namespace BrickWorlds::Voxel
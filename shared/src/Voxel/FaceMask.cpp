@@ -0,0 +1,100 @@
+#include "BrickWorlds/Voxel/FaceMask.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BRICKWORLDS_FACEMASK_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BRICKWORLDS_FACEMASK_SSE2 1
+#endif
+
+namespace BrickWorlds::Voxel {
+
+    static_assert(ColumnWords == 4, "Kernel ist fuer 256 hohe Chunks (4 x 64 Bit) geschrieben");
+
+    namespace {
+
+#if !defined(BRICKWORLDS_FACEMASK_AVX2)
+        // +Y/-Y innerhalb einer Spalte: Nachbar ist Bit y+1 bzw. y-1 (Ueberlauf ueber Wortgrenzen).
+        // Ueber/unter der Welt ist Air -> oberste/unterste Seite immer sichtbar.
+        inline void VerticalFacesScalar(const ColumnMask& c, ColumnMask& up, ColumnMask& down) {
+            for (int i = 0; i < ColumnWords; ++i) {
+                const std::uint64_t above = (c.w[i] >> 1) | (i + 1 < ColumnWords ? c.w[i + 1] << 63 : 0);
+                const std::uint64_t below = (c.w[i] << 1) | (i > 0 ? c.w[i - 1] >> 63 : 0);
+                up.w[i] = c.w[i] & ~above;
+                down.w[i] = c.w[i] & ~below;
+            }
+        }
+#endif
+
+#if defined(BRICKWORLDS_FACEMASK_AVX2)
+        inline __m256i Load(const ColumnMask& m) { return _mm256_load_si256(reinterpret_cast<const __m256i*>(m.w)); }
+        inline void Store(ColumnMask& m, __m256i v) { _mm256_store_si256(reinterpret_cast<__m256i*>(m.w), v); }
+#elif defined(BRICKWORLDS_FACEMASK_SSE2)
+        inline void AndNotSse2(const ColumnMask& c, const ColumnMask& nb, ColumnMask& out) {
+            const __m128i* pc = reinterpret_cast<const __m128i*>(c.w);
+            const __m128i* pn = reinterpret_cast<const __m128i*>(nb.w);
+            __m128i* po = reinterpret_cast<__m128i*>(out.w);
+            _mm_store_si128(po + 0, _mm_andnot_si128(_mm_load_si128(pn + 0), _mm_load_si128(pc + 0)));
+            _mm_store_si128(po + 1, _mm_andnot_si128(_mm_load_si128(pn + 1), _mm_load_si128(pc + 1)));
+        }
+#else
+        inline void AndNotScalar(const ColumnMask& c, const ColumnMask& nb, ColumnMask& out) {
+            for (int i = 0; i < ColumnWords; ++i) out.w[i] = c.w[i] & ~nb.w[i];
+        }
+#endif
+
+    } // namespace
+
+    void ComputeFaceMasks(const ChunkOccupancy& occ, ChunkFaceMasks& out) {
+#if defined(BRICKWORLDS_FACEMASK_AVX2)
+        const __m256i zero = _mm256_setzero_si256();
+#endif
+
+        for (int lz = 0; lz < ChunkZ; ++lz) {
+            for (int lx = 0; lx < ChunkX; ++lx) {
+                const int i = lz * ChunkX + lx;
+                const ColumnMask& c = occ.At(lx, lz);
+
+#if defined(BRICKWORLDS_FACEMASK_AVX2)
+                const __m256i v = Load(c);
+                Store(out.faces[0][i], _mm256_andnot_si256(Load(occ.At(lx, lz + 1)), v));
+                Store(out.faces[1][i], _mm256_andnot_si256(Load(occ.At(lx, lz - 1)), v));
+                Store(out.faces[4][i], _mm256_andnot_si256(Load(occ.At(lx + 1, lz)), v));
+                Store(out.faces[5][i], _mm256_andnot_si256(Load(occ.At(lx - 1, lz)), v));
+
+                // Wort i+1 bzw. i-1 in Lane i holen, Randlane auf 0 (Air)
+                const __m256i next = _mm256_blend_epi32(_mm256_permute4x64_epi64(v, _MM_SHUFFLE(0, 3, 2, 1)), zero, 0xC0);
+                const __m256i prev = _mm256_blend_epi32(_mm256_permute4x64_epi64(v, _MM_SHUFFLE(2, 1, 0, 3)), zero, 0x03);
+                const __m256i above = _mm256_or_si256(_mm256_srli_epi64(v, 1), _mm256_slli_epi64(next, 63));
+                const __m256i below = _mm256_or_si256(_mm256_slli_epi64(v, 1), _mm256_srli_epi64(prev, 63));
+                Store(out.faces[2][i], _mm256_andnot_si256(above, v));
+                Store(out.faces[3][i], _mm256_andnot_si256(below, v));
+#elif defined(BRICKWORLDS_FACEMASK_SSE2)
+                AndNotSse2(c, occ.At(lx, lz + 1), out.faces[0][i]);
+                AndNotSse2(c, occ.At(lx, lz - 1), out.faces[1][i]);
+                AndNotSse2(c, occ.At(lx + 1, lz), out.faces[4][i]);
+                AndNotSse2(c, occ.At(lx - 1, lz), out.faces[5][i]);
+                VerticalFacesScalar(c, out.faces[2][i], out.faces[3][i]);
+#else
+                AndNotScalar(c, occ.At(lx, lz + 1), out.faces[0][i]);
+                AndNotScalar(c, occ.At(lx, lz - 1), out.faces[1][i]);
+                AndNotScalar(c, occ.At(lx + 1, lz), out.faces[4][i]);
+                AndNotScalar(c, occ.At(lx - 1, lz), out.faces[5][i]);
+                VerticalFacesScalar(c, out.faces[2][i], out.faces[3][i]);
+#endif
+            }
+        }
+    }
+
+    const char* FaceMaskKernelName() {
+#if defined(BRICKWORLDS_FACEMASK_AVX2)
+        return "avx2";
+#elif defined(BRICKWORLDS_FACEMASK_SSE2)
+        return "sse2";
+#else
+        return "scalar";
+#endif
+    }
+
+} // namespace BrickWorlds::Voxel
@@ -1,56 +1,82 @@
 #include "BrickWorlds/Voxel/Jobs.h"
 
+#include <algorithm>
+#include <utility>
+
 namespace BrickWorlds::Voxel {
 
-    void JobQueue::Start(std::size_t threads) {
-        Stop();
-        running_.store(true, std::memory_order_relaxed);
-        workers_.reserve(threads);
-        for (std::size_t i = 0; i < threads; ++i) {
-            workers_.emplace_back([this] { WorkerLoop(); });
+    JobQueue::JobQueue(TaskScheduler& scheduler)
+        : scheduler_(scheduler) {
+    }
+
+    void JobQueue::Enqueue(Job job, Priority priority, Tag tag) {
+        {
+            std::lock_guard lk(mtx_);
+            heap_.push_back(Entry{ priority, nextSeq_++, tag, std::move(job) });
+            std::push_heap(heap_.begin(), heap_.end(), Later{});
+            ++submitted_;
         }
+        scheduler_.Submit([this] { RunNext(); });
     }
 
-    void JobQueue::Stop() {
-        bool wasRunning = running_.exchange(false, std::memory_order_relaxed);
-        if (!wasRunning) return;
+    void JobQueue::RunNext() {
+        Job job;
+        {
+            std::lock_guard lk(mtx_);
+            if (heap_.empty()) return;
 
-        cv_.notify_all();
-        for (auto& t : workers_) {
-            if (t.joinable()) t.join();
+            std::pop_heap(heap_.begin(), heap_.end(), Later{});
+            job = std::move(heap_.back().job);
+            heap_.pop_back();
         }
-        workers_.clear();
 
-        // Queue leeren (optional)
+        const auto t0 = std::chrono::steady_clock::now();
+        job();
+        const auto t1 = std::chrono::steady_clock::now();
+
+        busyNs_.fetch_add(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()), std::memory_order_relaxed);
+        completed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void JobQueue::RebuildHeap() {
+        std::make_heap(heap_.begin(), heap_.end(), Later{});
+    }
+
+    std::size_t JobQueue::Clear() {
+        std::lock_guard lk(mtx_);
+        const std::size_t removed = heap_.size();
+        heap_.clear();
+        cancelled_ += removed;
+        return removed;
+    }
+
+    std::size_t JobQueue::Pending() const {
         std::lock_guard lk(mtx_);
-        while (!q_.empty()) q_.pop();
+        return heap_.size();
     }
 
-    void JobQueue::Enqueue(Job job) {
+    JobQueueStats JobQueue::Stats() const {
+        JobQueueStats s;
         {
             std::lock_guard lk(mtx_);
-            q_.push(std::move(job));
+            s.submitted = submitted_;
+            s.cancelled = cancelled_;
+            s.pending = heap_.size();
+            s.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - statsSince_).count();
         }
-        cv_.notify_one();
+        s.completed = completed_.load(std::memory_order_relaxed);
+        s.busySeconds = static_cast<double>(busyNs_.load(std::memory_order_relaxed)) * 1e-9;
+        return s;
     }
 
-    void JobQueue::WorkerLoop() {
-        while (running_.load(std::memory_order_relaxed)) {
-            Job job;
-            {
-                std::unique_lock lk(mtx_);
-                cv_.wait(lk, [&] {
-                    return !running_.load(std::memory_order_relaxed) || !q_.empty();
-                    });
-
-                if (!running_.load(std::memory_order_relaxed)) return;
-                if (q_.empty()) continue;
-
-                job = std::move(q_.front());
-                q_.pop();
-            }
-            job();
-        }
+    void JobQueue::ResetStats() {
+        std::lock_guard lk(mtx_);
+        submitted_ = 0;
+        cancelled_ = 0;
+        completed_.store(0, std::memory_order_relaxed);
+        busyNs_.store(0, std::memory_order_relaxed);
+        statsSince_ = std::chrono::steady_clock::now();
     }
 
 } // namespace BrickWorlds::Voxel
@@ -0,0 +1,118 @@
+#include "BrickWorlds/Voxel/PaddedChunk.h"
+#include "BrickWorlds/Voxel/ChunkMesher.h"
+
+#include <algorithm>
+
+namespace BrickWorlds::Voxel {
+
+    namespace {
+
+        // Spalten [x0, x1) x [z0, z1), Zeilen [ly0, ly1] der Section sy von view nach out an (lx + ox, lz + oz)
+        void CopySection(const ChunkReadView& view, int sy, int ly0, int ly1, int x0, int x1, int z0, int z1, int ox, int oz, PaddedChunk& out) {
+            BlockId* dst = out.blocks.data();
+            const int y0 = sy * SectionY;
+
+            if (view.IsSectionUniform(sy)) {
+                const BlockId id = view.SectionId(sy);
+                for (int y = ly0; y <= ly1; ++y)
+                    for (int lz = z0; lz < z1; ++lz)
+                        std::fill_n(dst + PaddedChunk::PaddedIndex(x0 + ox, y, lz + oz), x1 - x0, id);
+                return;
+            }
+
+            const BlockStorage& storage = *view.Blocks().SectionStorage(sy);
+            for (int y = ly0; y <= ly1; ++y)
+                for (int lz = z0; lz < z1; ++lz) {
+                    storage.GetRange(Index(x0, y - y0, lz), x1 - x0, dst + PaddedChunk::PaddedIndex(x0 + ox, y, lz + oz));
+                }
+        }
+
+    } // namespace
+
+    std::uint8_t MissingNeighbors(const MeshNeighborhood& n) {
+        std::uint8_t bits = 0;
+        if (!n.minusX) bits |= NeighborMinusX;
+        if (!n.plusX) bits |= NeighborPlusX;
+        if (!n.minusZ) bits |= NeighborMinusZ;
+        if (!n.plusZ) bits |= NeighborPlusZ;
+        return bits;
+    }
+
+    void CopyPadded(const MeshNeighborhood& n, PaddedChunk& out, std::uint32_t sections) {
+        out.missing = MissingNeighbors(n);
+        out.sections = sections;
+        out.minY = n.center ? n.center.MinY() : ChunkY;
+        out.maxY = n.center ? n.center.MaxY() : -1;
+
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            // nur der belegte Bereich des Chunks; Nachbarn darueber/darunter erzeugen keine Seiten
+            const int ly0 = std::max(sy * SectionY, out.minY);
+            const int ly1 = std::min(sy * SectionY + SectionY - 1, out.maxY);
+            out.emptySection[sy] = !n.center || ly0 > ly1 || (n.center.IsSectionUniform(sy) && n.center.SectionId(sy) == Air);
+            if (out.emptySection[sy] || !(sections & (1u << sy))) continue;
+
+            CopySection(n.center, sy, ly0, ly1, 0, ChunkX, 0, ChunkZ, 0, 0, out);
+            if (n.minusX) CopySection(n.minusX, sy, ly0, ly1, ChunkX - 1, ChunkX, 0, ChunkZ, -ChunkX, 0, out);
+            if (n.plusX) CopySection(n.plusX, sy, ly0, ly1, 0, 1, 0, ChunkZ, ChunkX, 0, out);
+            if (n.minusZ) CopySection(n.minusZ, sy, ly0, ly1, 0, ChunkX, ChunkZ - 1, ChunkZ, 0, -ChunkZ, out);
+            if (n.plusZ) CopySection(n.plusZ, sy, ly0, ly1, 0, ChunkX, 0, 1, 0, ChunkZ, out);
+        }
+    }
+
+    void DownsamplePadded(const PaddedChunk& src, int lod, PaddedChunk& out) {
+        const int scale = LodScale(lod);
+        const int majority = (scale * scale * scale + 1) / 2;
+        BlockId* dst = out.blocks.data();
+
+        out.missing = 0;
+        out.sections = src.sections;
+        // auf ganze Zellen erweitert; Zeilen nicht leerer Sections werden alle geschrieben
+        out.minY = src.minY / scale * scale;
+        out.maxY = src.maxY < 0 ? -1 : (src.maxY / scale + 1) * scale - 1;
+
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            out.emptySection[sy] = src.emptySection[sy];
+            if (out.emptySection[sy] || !(src.sections & (1u << sy))) continue;
+
+            for (int y0 = sy * SectionY; y0 < (sy + 1) * SectionY; y0 += scale)
+                for (int z0 = 0; z0 < ChunkZ; z0 += scale)
+                    for (int x0 = 0; x0 < ChunkX; x0 += scale) {
+                        // von oben nach unten: der erste solide Block liefert die Id
+                        int solid = 0;
+                        BlockId top = Air;
+                        for (int y = std::min(y0 + scale - 1, src.maxY); y >= std::max(y0, src.minY); --y)
+                            for (int z = z0; z < z0 + scale; ++z)
+                                for (int x = x0; x < x0 + scale; ++x) {
+                                    const BlockId id = src.Get(x, y, z);
+                                    if (id == Air) continue;
+                                    if (top == Air) top = id;
+                                    ++solid;
+                                }
+
+                        const BlockId fill = (solid >= majority) ? top : BlockId{ Air };
+                        for (int y = y0; y < y0 + scale; ++y)
+                            for (int z = z0; z < z0 + scale; ++z)
+                                std::fill_n(dst + PaddedChunk::PaddedIndex(x0, y, z), scale, fill);
+                    }
+        }
+
+        // Rand = Randzelle eine Zelle tiefer: die Randseite entsteht nur an der Oberkante
+        // jeder Zellsaeule und haengt eine Zelle tief herab (Skirt)
+        auto edge = [&](int lx, int y, int lz) -> BlockId {
+            const int above = y + scale;
+            if (above >= ChunkY || out.emptySection[above / SectionY]) return Air;
+            return out.Get(lx, above, lz);
+        };
+        for (int sy = 0; sy < SectionCount; ++sy) {
+            if (out.emptySection[sy] || !(src.sections & (1u << sy))) continue;
+            for (int y = sy * SectionY; y < (sy + 1) * SectionY; ++y)
+                for (int i = 0; i < ChunkX; ++i) {
+                    dst[PaddedChunk::PaddedIndex(-1, y, i)] = edge(0, y, i);
+                    dst[PaddedChunk::PaddedIndex(ChunkX, y, i)] = edge(ChunkX - 1, y, i);
+                    dst[PaddedChunk::PaddedIndex(i, y, -1)] = edge(i, y, 0);
+                    dst[PaddedChunk::PaddedIndex(i, y, ChunkZ)] = edge(i, y, ChunkZ - 1);
+                }
+        }
+    }
+
+} // namespace BrickWorlds::Voxel
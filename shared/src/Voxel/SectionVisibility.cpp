@@ -0,0 +1,182 @@
+#include "BrickWorlds/Voxel/SectionVisibility.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace BrickWorlds::Voxel {
+
+    static_assert(SectionY == 16 && ChunkX == 16 && ChunkZ == 16, "Flood-Fill arbeitet auf 16-Bit-Spalten einer 16^3-Section");
+    static_assert(MeshFaceCount == 6 && FacePairBit(4, 5) == 14, "15 Seitenpaare");
+
+    namespace {
+
+        // Schritt pro MeshFace (+Z, -Z, +Y, -Y, +X, -X) in Sections
+        constexpr int FaceStep[MeshFaceCount][3] = {
+            { 0, 0, 1 }, { 0, 0, -1 }, { 0, 1, 0 }, { 0, -1, 0 }, { 1, 0, 0 }, { -1, 0, 0 },
+        };
+
+        // seed innerhalb der Spalte entlang zusammenhaengender offener Voxel ausdehnen
+        std::uint16_t FillColumn(std::uint16_t seed, std::uint16_t open) {
+            for (;;) {
+                const auto next = static_cast<std::uint16_t>((seed | (seed << 1) | (seed >> 1)) & open);
+                if (next == seed) return seed;
+                seed = next;
+            }
+        }
+
+        std::uint16_t ConnectFaces(std::uint8_t faces) {
+            std::uint16_t c = 0;
+            for (int a = 0; a < MeshFaceCount; ++a)
+                for (int b = a + 1; b < MeshFaceCount; ++b)
+                    if ((faces >> a & 1u) && (faces >> b & 1u)) c |= static_cast<std::uint16_t>(1u << FacePairBit(a, b));
+            return c;
+        }
+
+    } // namespace
+
+    std::uint16_t SectionConnectivity(const ChunkOccupancy& occ, int sy) {
+        const int y0 = sy * SectionY;
+        const int word = y0 >> 6;
+        const int shift = y0 & 63;
+
+        // offene Voxel je Spalte (Bit y = Air)
+        std::uint16_t open[ChunkX * ChunkZ];
+        bool anyOpen = false, allOpen = true;
+        for (int lz = 0; lz < ChunkZ; ++lz)
+            for (int lx = 0; lx < ChunkX; ++lx) {
+                const auto solid = static_cast<std::uint16_t>(occ.At(lx, lz).w[word] >> shift);
+                const auto o = static_cast<std::uint16_t>(~solid);
+                open[lz * ChunkX + lx] = o;
+                anyOpen |= o != 0;
+                allOpen &= o == 0xffff;
+            }
+        if (!anyOpen) return 0;
+        if (allOpen) return AllFacesConnected;
+
+        // Flood-Fill je Zusammenhangskomponente, bitparallel auf den 16-Bit-Spalten:
+        // abwechselnd vor- und rueckwaerts ueber alle Spalten, bis die Komponente nicht mehr waechst
+        std::uint16_t comp[ChunkX * ChunkZ];
+        std::uint16_t result = 0;
+
+        for (int seed = 0; seed < ChunkX * ChunkZ; ++seed) {
+            while (open[seed]) {
+                std::fill(std::begin(comp), std::end(comp), std::uint16_t{ 0 });
+                comp[seed] = FillColumn(static_cast<std::uint16_t>(open[seed] & (0u - open[seed])), open[seed]);
+
+                bool grown = true;
+                for (int pass = 0; grown; ++pass) {
+                    grown = false;
+                    const bool forward = (pass & 1) == 0;
+                    for (int i = 0; i < ChunkX * ChunkZ; ++i) {
+                        const int c = forward ? i : ChunkX * ChunkZ - 1 - i;
+                        if (!open[c]) continue;
+
+                        const int x = c & (ChunkX - 1);
+                        std::uint16_t from = comp[c];
+                        if (x > 0) from |= comp[c - 1];
+                        if (x < ChunkX - 1) from |= comp[c + 1];
+                        if (c >= ChunkX) from |= comp[c - ChunkX];
+                        if (c < ChunkX * (ChunkZ - 1)) from |= comp[c + ChunkX];
+
+                        const std::uint16_t next = FillColumn(static_cast<std::uint16_t>(from & open[c]), open[c]);
+                        if (next == comp[c]) continue;
+                        comp[c] = next;
+                        grown = true;
+                    }
+                }
+
+                // beruehrte Seiten der Komponente, dann aus open entfernen
+                std::uint16_t any = 0;
+                std::uint8_t faces = 0;
+                for (int c = 0; c < ChunkX * ChunkZ; ++c) {
+                    if (!comp[c]) continue;
+                    any |= comp[c];
+                    open[c] &= static_cast<std::uint16_t>(~comp[c]);
+                    const int x = c & (ChunkX - 1);
+                    const int z = c / ChunkX;
+                    if (z == ChunkZ - 1) faces |= 1u << FacePlusZ;
+                    if (z == 0) faces |= 1u << FaceMinusZ;
+                    if (x == ChunkX - 1) faces |= 1u << FacePlusX;
+                    if (x == 0) faces |= 1u << FaceMinusX;
+                }
+                if (any & (1u << (SectionY - 1))) faces |= 1u << FacePlusY;
+                if (any & 1u) faces |= 1u << FaceMinusY;
+
+                result |= ConnectFaces(faces);
+                if (result == AllFacesConnected) return result;
+            }
+        }
+        return result;
+    }
+
+    void SectionOcclusion::Begin(const ChunkKey& center, int radius) {
+        center_ = center;
+        radius_ = std::max(radius, 0);
+        width_ = 2 * radius_ + 1;
+
+        Cell open;
+        std::fill(std::begin(open.connectivity), std::end(open.connectivity), AllFacesConnected);
+        cells_.assign(static_cast<std::size_t>(width_) * width_, open);
+        visitedCount_ = 0;
+    }
+
+    int SectionOcclusion::CellIndex(int cx, int cz) const {
+        const int dx = cx - center_.cx + radius_;
+        const int dz = cz - center_.cz + radius_;
+        if (dx < 0 || dz < 0 || dx >= width_ || dz >= width_) return -1;
+        return dz * width_ + dx;
+    }
+
+    void SectionOcclusion::SetChunk(const ChunkKey& key, const std::uint16_t* connectivity, bool inFrustum) {
+        const int i = CellIndex(key.cx, key.cz);
+        if (i < 0) return;
+        Cell& cell = cells_[static_cast<std::size_t>(i)];
+        std::copy(connectivity, connectivity + SectionCount, cell.connectivity);
+        cell.inFrustum = inFrustum;
+    }
+
+    void SectionOcclusion::Traverse(int cameraSy) {
+        if (cells_.empty()) return;
+
+        queue_.clear();
+        const int start = CellIndex(center_.cx, center_.cz);
+        const int sy = std::clamp(cameraSy, 0, SectionCount - 1);
+        cells_[static_cast<std::size_t>(start)].visited |= 1u << sy;
+        queue_.push_back({ start, sy, -1, 0 });
+
+        // queue_ waechst waehrend der Schleife: Index statt Iterator
+        for (std::size_t head = 0; head < queue_.size(); ++head) {
+            const Node node = queue_[head];
+            const Cell& cell = cells_[static_cast<std::size_t>(node.cell)];
+            const int cx = node.cell % width_;
+            const int cz = node.cell / width_;
+
+            for (int face = 0; face < MeshFaceCount; ++face) {
+                // nie zurueck in Richtung Kamera
+                if (node.directions & (1u << OppositeFace(face))) continue;
+                if (node.entry >= 0 && !FacesConnected(cell.connectivity[node.sy], node.entry, face)) continue;
+
+                const int nx = cx + FaceStep[face][0];
+                const int ny = node.sy + FaceStep[face][1];
+                const int nz = cz + FaceStep[face][2];
+                if (nx < 0 || nz < 0 || nx >= width_ || nz >= width_ || ny < 0 || ny >= SectionCount) continue;
+
+                const int ni = nz * width_ + nx;
+                Cell& next = cells_[static_cast<std::size_t>(ni)];
+                if (!next.inFrustum || (next.visited & (1u << ny))) continue;
+
+                next.visited |= 1u << ny;
+                queue_.push_back({ ni, ny, static_cast<std::int8_t>(OppositeFace(face)),
+                    static_cast<std::uint8_t>(node.directions | (1u << face)) });
+            }
+        }
+        visitedCount_ = queue_.size();
+    }
+
+    std::uint32_t SectionOcclusion::VisibleSections(const ChunkKey& key) const {
+        const int i = CellIndex(key.cx, key.cz);
+        if (i < 0 || cells_.empty()) return 0;
+        return cells_[static_cast<std::size_t>(i)].visited;
+    }
+
+} // namespace BrickWorlds::Voxel
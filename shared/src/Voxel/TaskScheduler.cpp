@@ -0,0 +1,136 @@
+#include "BrickWorlds/Voxel/TaskScheduler.h"
+
+#include <algorithm>
+
+namespace BrickWorlds::Voxel {
+
+    // Worker-Identitaet des aktuellen Threads (Submit aus einem Task geht in die eigene Deque)
+    static thread_local const TaskScheduler* tlsScheduler = nullptr;
+    static thread_local std::size_t tlsWorker = 0;
+
+    void TaskScheduler::Start(std::size_t threads) {
+        // Vor Start() eingereichte Tasks bleiben im Injector und laufen gleich los
+        JoinWorkers();
+        if (threads == 0) threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+        // Erst alle Worker anlegen, dann Threads starten (Diebe iterieren ueber workers_)
+        workers_.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) workers_.push_back(std::make_unique<Worker>());
+
+        running_.store(true, std::memory_order_release);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_[i]->thread = std::thread([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    void TaskScheduler::Stop() {
+        JoinWorkers();
+
+        std::lock_guard lk(injectMtx_);
+        inject_.clear();
+        queued_.store(0, std::memory_order_relaxed);
+    }
+
+    void TaskScheduler::JoinWorkers() {
+        const bool wasRunning = running_.exchange(false, std::memory_order_acq_rel);
+        if (wasRunning) {
+            {
+                std::lock_guard lk(sleepMtx_);
+            }
+            sleepCv_.notify_all();
+            for (auto& w : workers_) {
+                if (w->thread.joinable()) w->thread.join();
+            }
+        }
+
+        // Liegengebliebene Tasks der Worker-Deques zurueck in den Injector (queued_ zaehlt sie noch)
+        std::lock_guard lk(injectMtx_);
+        for (auto& w : workers_) {
+            for (Task& t : w->tasks) inject_.push_back(std::move(t));
+        }
+        workers_.clear();
+    }
+
+    void TaskScheduler::Submit(Task task) {
+        if (tlsScheduler == this) {
+            Worker& w = *workers_[tlsWorker];
+            std::lock_guard lk(w.mtx);
+            w.tasks.push_back(std::move(task));
+        }
+        else {
+            std::lock_guard lk(injectMtx_);
+            inject_.push_back(std::move(task));
+        }
+        queued_.fetch_add(1, std::memory_order_release);
+
+        // Lock kurz nehmen: ein Worker zwischen Praedikat-Pruefung und wait() verpasst sonst das notify
+        {
+            std::lock_guard lk(sleepMtx_);
+        }
+        sleepCv_.notify_one();
+    }
+
+    bool TaskScheduler::TryPop(std::size_t index, Task& out) {
+        {
+            Worker& w = *workers_[index];
+            std::lock_guard lk(w.mtx);
+            if (!w.tasks.empty()) {
+                out = std::move(w.tasks.back());
+                w.tasks.pop_back();
+                return true;
+            }
+        }
+
+        std::lock_guard lk(injectMtx_);
+        if (inject_.empty()) return false;
+        out = std::move(inject_.front());
+        inject_.pop_front();
+        return true;
+    }
+
+    bool TaskScheduler::TrySteal(std::size_t thief, Task& out) {
+        const std::size_t n = workers_.size();
+        for (std::size_t k = 1; k < n; ++k) {
+            Worker& victim = *workers_[(thief + k) % n];
+            std::lock_guard lk(victim.mtx);
+            if (victim.tasks.empty()) continue;
+
+            out = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            stolen_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void TaskScheduler::WorkerLoop(std::size_t index) {
+        tlsScheduler = this;
+        tlsWorker = index;
+
+        while (running_.load(std::memory_order_acquire)) {
+            Task task;
+            if (TryPop(index, task) || TrySteal(index, task)) {
+                queued_.fetch_sub(1, std::memory_order_relaxed);
+                task();
+                executed_.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+
+            std::unique_lock lk(sleepMtx_);
+            sleepCv_.wait(lk, [&] {
+                return !running_.load(std::memory_order_acquire) || queued_.load(std::memory_order_acquire) > 0;
+                });
+        }
+
+        tlsScheduler = nullptr;
+    }
+
+    TaskSchedulerStats TaskScheduler::Stats() const {
+        TaskSchedulerStats s;
+        s.executed = executed_.load(std::memory_order_relaxed);
+        s.stolen = stolen_.load(std::memory_order_relaxed);
+        s.workers = workers_.size();
+        return s;
+    }
+
+} // namespace BrickWorlds::Voxel
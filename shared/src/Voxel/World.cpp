@@ -1,8 +1,12 @@
 #include "BrickWorlds/Voxel/World.h"
+#include "BrickWorlds/Core/Profiler.h"
 #include "BrickWorlds/Voxel/BlockId.h"
+#include "BrickWorlds/Voxel/ChunkMesher.h"
 
 #include <algorithm>
-#include <unordered_set>
+#include <cstdlib>
+#include <unordered_map>
+#include <utility>
 
 namespace BrickWorlds::Voxel {
 
@@ -22,14 +26,29 @@ namespace BrickWorlds::Voxel {
         : generator_(generator) {
     }
 
-    void World::StartStreaming(std::size_t genThreads, std::size_t meshThreads) {
-        genQ_.Start(std::max<std::size_t>(1, genThreads));
-        meshQ_.Start(std::max<std::size_t>(1, meshThreads));
+    World::~World() {
+        // Worker stoppen, bevor die Queues (Pump-Tasks zeigen auf sie) zerstoert werden
+        StopStreaming();
+    }
+
+    void World::StartStreaming(std::size_t workerThreads) {
+        scheduler_.Start(workerThreads);
+        genQ_.ResetStats();
+        meshQ_.ResetStats();
     }
 
     void World::StopStreaming() {
-        genQ_.Stop();
-        meshQ_.Stop();
+        scheduler_.Stop();
+        genQ_.Clear();
+        meshQ_.Clear();
+    }
+
+    StreamingStats World::StreamStats() const {
+        StreamingStats s;
+        s.generate = genQ_.Stats();
+        s.mesh = meshQ_.Stats();
+        s.scheduler = scheduler_.Stats();
+        return s;
     }
 
     ChunkKey World::WorldToChunk(int wx, int wz) {
@@ -52,27 +71,48 @@ namespace BrickWorlds::Voxel {
 
         auto ch = chunks_.GetChunk(ck);
         if (!ch) return Air;
-        return ch->Get(lx, ly, lz);
+        // ueber dem obersten Block der Spalte nur Luft: ohne Palette-Zugriff
+        const ChunkReadView view = ch->View();
+        if (ly > view.Height(lx, lz)) return Air;
+        return view.Get(lx, ly, lz);
     }
 
-    void World::MarkNeighborsDirtyIfEdge(const ChunkKey& ck, int lx, int lz) {
-        // Wenn an der Chunk-Kante: Nachbarn remesh anstoen (wenn geladen)
-        if (lx == 0) {
-            auto nb = chunks_.GetChunk({ ck.cx - 1, ck.cz });
-            if (nb) nb->MarkDirtyMesh();
-        }
-        else if (lx == ChunkX - 1) {
-            auto nb = chunks_.GetChunk({ ck.cx + 1, ck.cz });
-            if (nb) nb->MarkDirtyMesh();
-        }
+    int World::GetHeight(int wx, int wz) const {
+        int lx, ly, lz;
+        WorldToLocal(wx, 0, wz, lx, ly, lz);
 
-        if (lz == 0) {
-            auto nb = chunks_.GetChunk({ ck.cx, ck.cz - 1 });
-            if (nb) nb->MarkDirtyMesh();
-        }
-        else if (lz == ChunkZ - 1) {
-            auto nb = chunks_.GetChunk({ ck.cx, ck.cz + 1 });
-            if (nb) nb->MarkDirtyMesh();
+        auto ch = chunks_.GetChunk(WorldToChunk(wx, wz));
+        if (!ch) return -1;
+        return ch->Height(lx, lz);
+    }
+
+    static constexpr int NeighborOffsets[4][2] = { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } };
+
+    // Seiten aller Sections, die zum Nachbarn in Richtung (dx, dz) zeigen
+    static MeshDirtyMask FacesToward(int dx, int dz) {
+        const int face = dx < 0 ? FaceMinusX : dx > 0 ? FacePlusX : dz < 0 ? FaceMinusZ : FacePlusZ;
+        MeshDirtyMask m;
+        m.AddSections(0, SectionCount - 1, 1 << face);
+        return m;
+    }
+
+    void World::EdgeDirty::Add(int lx0, int ly0, int lz0, int lx1, int ly1, int lz1) {
+        // Im Nachbarn aendern sich nur die Seiten, die auf diesen Chunk zeigen
+        const int sy0 = ly0 / SectionY;
+        const int sy1 = ly1 / SectionY;
+        if (lx0 == 0) neighbors[0].AddSections(sy0, sy1, 1 << FacePlusX);
+        if (lx1 == ChunkX - 1) neighbors[1].AddSections(sy0, sy1, 1 << FaceMinusX);
+        if (lz0 == 0) neighbors[2].AddSections(sy0, sy1, 1 << FacePlusZ);
+        if (lz1 == ChunkZ - 1) neighbors[3].AddSections(sy0, sy1, 1 << FaceMinusZ);
+    }
+
+    void World::MarkNeighborsDirty(const ChunkKey& ck, const EdgeDirty& edges) {
+        for (int i = 0; i < 4; ++i) {
+            if (!edges.neighbors[i].Any()) continue;
+            auto nb = chunks_.GetChunk({ ck.cx + NeighborOffsets[i][0], ck.cz + NeighborOffsets[i][1] });
+            if (!nb) continue;
+            nb->MarkDirtyMesh(edges.neighbors[i]);
+            RequestRemesh(nb);
         }
     }
 
@@ -84,14 +124,217 @@ namespace BrickWorlds::Voxel {
         WorldToLocal(wx, wy, wz, lx, ly, lz);
 
         auto ch = chunks_.GetOrCreate(ck);
+        NoteEditedChunk(ck);
         ch->Set(lx, ly, lz, id);
-        MarkNeighborsDirtyIfEdge(ck, lx, lz);
+        RequestRemesh(ch);
+
+        EdgeDirty edges;
+        edges.Add(lx, ly, lz, lx, ly, lz);
+        MarkNeighborsDirty(ck, edges);
+    }
+
+    void World::MarkNeighborsDirtyBatch(const std::vector<std::pair<ChunkKey, EdgeDirty>>& edgesPerChunk) {
+        // Jeden Nachbarn nur einmal anfassen, Buckets aller angrenzenden Edits vereinigt
+        std::unordered_map<ChunkKey, MeshDirtyMask, ChunkKeyHash> neighbours;
+        for (auto& [ck, edges] : edgesPerChunk) {
+            for (int i = 0; i < 4; ++i) {
+                if (!edges.neighbors[i].Any()) continue;
+                neighbours[{ ck.cx + NeighborOffsets[i][0], ck.cz + NeighborOffsets[i][1] }] |= edges.neighbors[i];
+            }
+        }
+
+        for (auto& [nk, mask] : neighbours) {
+            auto nb = chunks_.GetChunk(nk);
+            if (!nb) continue;
+            nb->MarkDirtyMesh(mask);
+            RequestRemesh(nb);
+        }
+    }
+
+    std::size_t World::ApplyEdits(const BlockEdit* edits, std::size_t count) {
+        struct LocalEdit {
+            ChunkKey key;
+            int lx, ly, lz;
+            BlockId id;
+        };
+
+        std::vector<LocalEdit> sorted;
+        sorted.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const BlockEdit& e = edits[i];
+            if (e.wy < 0 || e.wy >= ChunkY) continue;
+
+            int lx, ly, lz;
+            WorldToLocal(e.wx, e.wy, e.wz, lx, ly, lz);
+            sorted.push_back({ WorldToChunk(e.wx, e.wz), lx, ly, lz, e.id });
+        }
+
+        // stabil: Edits auf denselben Block behalten ihre Reihenfolge
+        std::stable_sort(sorted.begin(), sorted.end(), [](const LocalEdit& a, const LocalEdit& b) {
+            return (a.key.cx != b.key.cx) ? (a.key.cx < b.key.cx) : (a.key.cz < b.key.cz);
+            });
+
+        std::size_t changed = 0;
+        std::vector<std::pair<ChunkKey, EdgeDirty>> edgesPerChunk;
+
+        for (std::size_t begin = 0; begin < sorted.size();) {
+            std::size_t end = begin + 1;
+            while (end < sorted.size() && sorted[end].key == sorted[begin].key) ++end;
+
+            EdgeDirty edges;
+            MeshDirtyMask dirty;
+            std::size_t chunkChanged = 0;
+            auto ch = chunks_.GetOrCreate(sorted[begin].key);
+            NoteEditedChunk(sorted[begin].key);
+            ch->Edit([&](ChunkBlocks& b) {
+                for (std::size_t i = begin; i < end; ++i) {
+                    const LocalEdit& e = sorted[i];
+                    const int index = Index(e.lx, e.ly, e.lz);
+                    if (b.Get(index) == e.id) continue;
+                    b.Set(index, e.id);
+                    dirty |= MeshDirtyMask::ForRows(e.ly, e.ly);
+                    edges.Add(e.lx, e.ly, e.lz, e.lx, e.ly, e.lz);
+                    ++chunkChanged;
+                }
+                return chunkChanged > 0;
+                });
+
+            if (chunkChanged > 0) {
+                changed += chunkChanged;
+                edgesPerChunk.emplace_back(sorted[begin].key, edges);
+                ch->MarkDirtyMesh(dirty);
+                RequestRemesh(ch);
+            }
+            begin = end;
+        }
+
+        MarkNeighborsDirtyBatch(edgesPerChunk);
+        return changed;
+    }
+
+    template <typename Op>
+    std::size_t World::EditBox(int x0, int y0, int z0, int x1, int y1, int z1, Op&& op) {
+        if (x0 > x1) std::swap(x0, x1);
+        if (y0 > y1) std::swap(y0, y1);
+        if (z0 > z1) std::swap(z0, z1);
+        y0 = std::max(y0, 0);
+        y1 = std::min(y1, ChunkY - 1);
+        if (y0 > y1) return 0;
+
+        const ChunkKey c0 = WorldToChunk(x0, z0);
+        const ChunkKey c1 = WorldToChunk(x1, z1);
+
+        std::size_t changed = 0;
+        std::vector<std::pair<ChunkKey, EdgeDirty>> edgesPerChunk;
+
+        for (int cz = c0.cz; cz <= c1.cz; ++cz) {
+            for (int cx = c0.cx; cx <= c1.cx; ++cx) {
+                const ChunkKey ck{ cx, cz };
+                const int lx0 = std::max(x0 - cx * ChunkX, 0);
+                const int lx1 = std::min(x1 - cx * ChunkX, ChunkX - 1);
+                const int lz0 = std::max(z0 - cz * ChunkZ, 0);
+                const int lz1 = std::min(z1 - cz * ChunkZ, ChunkZ - 1);
+
+                std::size_t chunkChanged = 0;
+                auto ch = chunks_.GetOrCreate(ck);
+                NoteEditedChunk(ck);
+                ch->Edit([&](ChunkBlocks& b) {
+                    chunkChanged = op(b, lx0, y0, lz0, lx1, y1, lz1);
+                    return chunkChanged > 0;
+                    });
+                if (chunkChanged == 0) continue;
+
+                changed += chunkChanged;
+                ch->MarkDirtyMesh(MeshDirtyMask::ForRows(y0, y1));
+                RequestRemesh(ch);
+                EdgeDirty edges;
+                edges.Add(lx0, y0, lz0, lx1, y1, lz1);
+                edgesPerChunk.emplace_back(ck, edges);
+            }
+        }
+
+        MarkNeighborsDirtyBatch(edgesPerChunk);
+        return changed;
+    }
+
+    std::size_t World::FillBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockId id) {
+        return EditBox(x0, y0, z0, x1, y1, z1,
+            [id](ChunkBlocks& b, int lx0, int ly0, int lz0, int lx1, int ly1, int lz1) {
+                std::size_t n = 0;
+                const bool fullColumn = lx0 == 0 && lz0 == 0 && lx1 == ChunkX - 1 && lz1 == ChunkZ - 1;
+
+                for (int sy = ly0 / SectionY; sy <= ly1 / SectionY; ++sy) {
+                    if (b.IsSectionUniform(sy) && b.SectionId(sy) == id) continue;
+
+                    const int sy0 = std::max(ly0, sy * SectionY);
+                    const int sy1 = std::min(ly1, sy * SectionY + SectionY - 1);
+
+                    // komplette Section: ohne Einzel-Writes als uniform setzen
+                    if (fullColumn && sy0 == sy * SectionY && sy1 == sy * SectionY + SectionY - 1) {
+                        if (b.IsSectionUniform(sy)) n += SectionVolume;
+                        else {
+                            const BlockStorage& s = *b.SectionStorage(sy);
+                            for (int i = 0; i < SectionVolume; ++i) n += (s.Get(i) != id) ? 1 : 0;
+                        }
+                        b.FillSection(sy, id);
+                        continue;
+                    }
+
+                    for (int y = sy0; y <= sy1; ++y)
+                        for (int z = lz0; z <= lz1; ++z)
+                            for (int x = lx0; x <= lx1; ++x) {
+                                const int idx = Index(x, y, z);
+                                if (b.Get(idx) == id) continue;
+                                b.Set(idx, id);
+                                ++n;
+                            }
+                }
+                return n;
+            });
+    }
+
+    std::size_t World::ReplaceInBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockId from, BlockId to) {
+        if (from == to) return 0;
+
+        return EditBox(x0, y0, z0, x1, y1, z1,
+            [from, to](ChunkBlocks& b, int lx0, int ly0, int lz0, int lx1, int ly1, int lz1) {
+                std::size_t n = 0;
+                const bool fullColumn = lx0 == 0 && lz0 == 0 && lx1 == ChunkX - 1 && lz1 == ChunkZ - 1;
+
+                for (int sy = ly0 / SectionY; sy <= ly1 / SectionY; ++sy) {
+                    const int sy0 = std::max(ly0, sy * SectionY);
+                    const int sy1 = std::min(ly1, sy * SectionY + SectionY - 1);
+
+                    if (b.IsSectionUniform(sy)) {
+                        if (b.SectionId(sy) != from) continue;
+                        if (fullColumn && sy0 == sy * SectionY && sy1 == sy * SectionY + SectionY - 1) {
+                            b.FillSection(sy, to);
+                            n += SectionVolume;
+                            continue;
+                        }
+                    }
+
+                    for (int y = sy0; y <= sy1; ++y)
+                        for (int z = lz0; z <= lz1; ++z)
+                            for (int x = lx0; x <= lx1; ++x) {
+                                const int idx = Index(x, y, z);
+                                if (b.Get(idx) != from) continue;
+                                b.Set(idx, to);
+                                ++n;
+                            }
+                }
+                return n;
+            });
+    }
 
-        // Optional: wenn Mesh-Worker luft, gleich meshen
-        // EnqueueMesh(ch);
+    // Quadrierter Abstand zum Streaming-Center (in Chunks): naechste Chunks zuerst
+    static JobQueue::Priority GenPriority(const ChunkKey& k, const ChunkKey& center) {
+        const JobQueue::Priority dx = k.cx - center.cx;
+        const JobQueue::Priority dz = k.cz - center.cz;
+        return dx * dx + dz * dz;
     }
 
-    void World::EnqueueGenerate(const std::shared_ptr<Chunk>& ch) {
+    void World::EnqueueGenerate(const std::shared_ptr<Chunk>& ch, JobQueue::Priority priority) {
         if (!generator_) return;
 
         // Nur wenn leer/noch nicht generiert
@@ -99,60 +342,268 @@ namespace BrickWorlds::Voxel {
 
         ch->SetState(ChunkState::Generating);
         genQ_.Enqueue([this, ch] {
+            // Chunk wurde entladen, waehrend der Job wartete
+            if (ch->State() == ChunkState::Unloading) return;
             {
+                Core::ScopedTimer timer(Core::ProfileStage::GenerateChunk);
                 std::scoped_lock lk(ch->Mutex());
                 generator_->Generate(*ch);
+                ch->BlocksUnsafe().Compact();
+                ch->BlocksUnsafe().RecomputeHeights();
+                ch->PublishUnsafe();
             }
-            ch->SetState(ChunkState::ReadyData);
+            // Waehrend der Generierung entladen -> kein Meshing mehr anstossen
+            if (!ch->TransitionState(ChunkState::Generating, ChunkState::ReadyData)) return;
             ch->MarkDirtyMesh();
-            //EnqueueMesh(ch);
-            });
+
+            // Dieser Chunk und seine Nachbarn koennen jetzt ggf. gemesht werden
+            TryScheduleMesh(ch->Key());
+            OnDataReady(ch->Key());
+            }, priority, PackChunkKey(ch->Key()));
+    }
+
+    static bool HasData(const std::shared_ptr<Chunk>& ch) {
+        if (!ch) return false;
+        const ChunkState st = ch->State();
+        return st == ChunkState::ReadyData || st == ChunkState::Meshing || st == ChunkState::ReadyMesh;
+    }
+
+    void World::TryScheduleMesh(const ChunkKey& ck) {
+        if (!meshingEnabled_.load(std::memory_order_relaxed)) return;
+        auto ch = chunks_.GetChunk(ck);
+        if (!ch || ch->State() != ChunkState::ReadyData) return;
+
+        // Erst meshen, wenn alle 4 Nachbarn Daten haben: Randflaechen stimmen beim ersten Mesh
+        if (!HasData(chunks_.GetChunk({ ck.cx - 1, ck.cz })) ||
+            !HasData(chunks_.GetChunk({ ck.cx + 1, ck.cz })) ||
+            !HasData(chunks_.GetChunk({ ck.cx, ck.cz - 1 })) ||
+            !HasData(chunks_.GetChunk({ ck.cx, ck.cz + 1 })))
+            return;
+
+        // Mehrere fertige Nachbarn koennen gleichzeitig hier ankommen: nur einer gewinnt
+        if (!ch->TransitionState(ChunkState::ReadyData, ChunkState::Meshing)) return;
+        EnqueueMesh(ch);
+    }
+
+    void World::OnDataReady(const ChunkKey& ck) {
+        // Gegenstueck zum Fence in BuildMesh: entweder sieht der Mesh-Job unseren State
+        // oder wir sehen sein Missing-Bit
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (const auto& o : NeighborOffsets) {
+            const ChunkKey nk{ ck.cx + o[0], ck.cz + o[1] };
+            TryScheduleMesh(nk);
+
+            auto nb = chunks_.GetChunk(nk);
+            // aus Sicht des Nachbarn liegt ck in Gegenrichtung
+            if (nb && nb->ClearMissingNeighbor(NeighborBit(-o[0], -o[1]))) {
+                nb->MarkDirtyMesh(FacesToward(-o[0], -o[1]));
+                RequestRemesh(nb);
+            }
+        }
     }
 
     void World::EnqueueMesh(const std::shared_ptr<Chunk>& ch) {
-        // Minimal: kein echtes Meshing, nur State-bergang + Platzhalter
-        if (ch->State() == ChunkState::Meshing) return;
+        const ChunkKey k = ch->Key();
+        const JobQueue::Priority priority = prioritizedGeneration_
+            ? GenPriority(k, UnpackChunkKey(priorityCenter_.load(std::memory_order_relaxed))) : 0;
 
-        if (!ch->ConsumeDirtyMesh()) return;
+        meshQ_.Enqueue([this, ch] { BuildMesh(ch); }, priority, PackChunkKey(k));
+    }
 
-        ch->SetState(ChunkState::Meshing);
-        meshQ_.Enqueue([ch] {
-            // TODO: hier spter Face-Culling/Greedy-Meshing implementieren
-            // aktuell nur "mesh exists" markieren
-            {
-                std::scoped_lock lk(ch->Mutex());
-                ch->Mesh().Clear();
+    void World::RequestRemesh(const std::shared_ptr<Chunk>& ch) {
+        if (ch->TransitionState(ChunkState::ReadyMesh, ChunkState::Meshing)) EnqueueMesh(ch);
+    }
+
+    void World::BuildMesh(const std::shared_ptr<Chunk>& ch) {
+        // Chunk wurde entladen, waehrend der Job wartete
+        if (ch->State() == ChunkState::Unloading) return;
+        Core::ScopedTimer timer(Core::ProfileStage::MeshChunk);
+
+        // Edits ab hier setzen ihre Buckets erneut und loesen einen weiteren Durchlauf aus
+        const MeshDirtyMask dirty = ch->ConsumeDirtyMesh();
+
+        const ChunkKey k = ch->Key();
+        // Nachbarn ohne Daten (entladen, noch in Generierung) zaehlen als fehlend
+        auto viewOf = [&](int dx, int dz) {
+            auto nb = chunks_.GetChunk({ k.cx + dx, k.cz + dz });
+            return HasData(nb) ? nb->View() : ChunkReadView{};
+        };
+        const MeshNeighborhood n{ k, ch->View(), viewOf(-1, 0), viewOf(1, 0), viewOf(0, -1), viewOf(0, 1) };
+
+        // Puffer pro Worker: nach dem Tausch haelt er die alten Puffer des Chunks (Kapazitaet bleibt)
+        static thread_local ChunkMeshData scratch;
+        const ChunkMesher mesher(meshMode_.load(std::memory_order_relaxed));
+        if (const int lod = ch->Lod(); lod > 0) {
+            // LOD-Meshes immer komplett (Edits in der Ferne sind selten)
+            mesher.BuildLod(n, lod, scratch);
+        }
+        else if (dirty.IsAll()) {
+            mesher.Build(n, scratch);
+        }
+        else {
+            // Nur dirty Buckets neu, der Rest wird direkt aus dem aktuellen Mesh uebernommen
+            // (keine Kopie, kein Lock: der Renderer liest parallel nur)
+            mesher.Update(n, dirty, ch->MeshForRemesh(), scratch);
+        }
+        ch->SwapMesh(scratch);
+        // Waehrend des Meshens entladen: der Renderer hat das Mesh schon freigegeben
+        if (ch->State() == ChunkState::Unloading) return;
+        meshResults_.Push(MeshReady{ k });
+
+        // Fehlende Nachbarn merken; OnDataReady loest beim Eintreffen genau einen Remesh aus.
+        // Ist ein Nachbar inzwischen schon da, uebernehmen wir das hier selbst.
+        const std::uint8_t missing = MissingNeighbors(n);
+        ch->SetMissingNeighbors(missing);
+        if (missing) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            for (const auto& o : NeighborOffsets) {
+                const std::uint8_t bit = NeighborBit(o[0], o[1]);
+                if ((missing & bit) && HasData(chunks_.GetChunk({ k.cx + o[0], k.cz + o[1] })) &&
+                    ch->ClearMissingNeighbor(bit))
+                    ch->MarkDirtyMesh(FacesToward(o[0], o[1]));
             }
-            ch->SetState(ChunkState::ReadyMesh);
-            });
+        }
+
+        // Waehrend des Meshens entladen -> nichts weiter
+        if (!ch->TransitionState(ChunkState::Meshing, ChunkState::ReadyMesh)) return;
+        if (ch->IsMeshDirty()) RequestRemesh(ch);
+    }
+
+    static bool InSquare(const ChunkKey& k, const ChunkKey& center, int radius) {
+        return radius >= 0
+            && std::abs(k.cx - center.cx) <= radius
+            && std::abs(k.cz - center.cz) <= radius;
+    }
+
+    void World::SetUnloadHysteresis(int chunks) {
+        unloadHysteresis_ = std::max(0, chunks);
+    }
+
+    void World::SetPrioritizedGeneration(bool enabled) {
+        prioritizedGeneration_ = enabled;
+    }
+
+    void World::SetMeshMode(MeshMode mode) {
+        meshMode_.store(mode, std::memory_order_relaxed);
+    }
+
+    void World::SetMeshingEnabled(bool enabled) {
+        meshingEnabled_.store(enabled, std::memory_order_relaxed);
+    }
+
+    void World::SetLodDistance(int chunks) {
+        chunks = std::max(0, chunks);
+        if (chunks == lodDistance_) return;
+        lodDistance_ = chunks;
+        lodChanged_ = true;
+    }
+
+    static int LodFor(const ChunkKey& k, const ChunkKey& center, int lodDistance) {
+        if (lodDistance <= 0) return 0;
+        const int d = std::max(std::abs(k.cx - center.cx), std::abs(k.cz - center.cz));
+        int lod = 0;
+        for (int limit = lodDistance; d > limit && lod < MaxLod; limit *= 2) ++lod;
+        return lod;
+    }
+
+    void World::NoteEditedChunk(const ChunkKey& ck) {
+        if (!InSquare(ck, streamCenter_, streamUnloadRadius_)) strayChunks_.insert(ck);
+    }
+
+    void World::UnloadChunk(const ChunkKey& ck) {
+        auto ch = chunks_.GetChunk(ck);
+        if (!ch) return;
+        // auch ohne Priorisierung: wartende/laufende Jobs brechen darauf ab
+        ch->SetState(ChunkState::Unloading);
+        chunks_.Remove(ck);
+        // Renderer gibt das Mesh frei, ohne jeden Frame alle Chunks abzugleichen
+        if (meshingEnabled_.load(std::memory_order_relaxed)) meshResults_.Push(MeshReady{ ck, true });
     }
 
     void World::UpdateStreaming(int playerWx, int playerWz, int viewDistanceChunks) {
+        Core::ScopedTimer timer(Core::ProfileStage::UpdateStreaming);
+
         const ChunkKey center = WorldToChunk(playerWx, playerWz);
+        // +1: die aeusserste sichtbare Reihe braucht Nachbardaten zum Meshen
+        const int loadRadius = viewDistanceChunks + 1;
+        // vom Lade-Radius aus: auch mit Hysterese 0 nie kleiner als das Lade-Quadrat
+        const int unloadRadius = loadRadius + unloadHysteresis_;
+
+        // Durch Edits angelegte Chunks ausserhalb des alten Entlade-Quadrats: im neuen
+        // Quadrat uebernimmt sie der Rand-Durchlauf, alle anderen werden entladen
+        for (const ChunkKey& ck : strayChunks_) {
+            if (!InSquare(ck, center, unloadRadius)) UnloadChunk(ck);
+        }
+        strayChunks_.clear();
 
-        // Zielmenge der Chunks im Radius
-        std::unordered_set<ChunkKey, ChunkKeyHash> wanted;
-        wanted.reserve((2 * viewDistanceChunks + 1) * (2 * viewDistanceChunks + 1));
+        // Nichts zu tun, solange der Spieler im selben Chunk bleibt
+        if (center == streamCenter_ && loadRadius == streamLoadRadius_ && unloadRadius == streamUnloadRadius_ && !lodChanged_)
+            return;
 
-        for (int dz = -viewDistanceChunks; dz <= viewDistanceChunks; ++dz) {
-            for (int dx = -viewDistanceChunks; dx <= viewDistanceChunks; ++dx) {
-                ChunkKey ck{ center.cx + dx, center.cz + dz };
-                wanted.insert(ck);
+        // Wartende Generate-Jobs nach neuer Entfernung sortieren
+        if (prioritizedGeneration_ && !(center == streamCenter_)) {
+            priorityCenter_.store(PackChunkKey(center), std::memory_order_relaxed);
+            auto byDistance = [&](JobQueue::Tag tag) { return GenPriority(UnpackChunkKey(tag), center); };
+            genQ_.Reprioritize(byDistance);
+            meshQ_.Reprioritize(byDistance);
+        }
+
+        // Laden: neues Lade-Quadrat minus altes Lade-Quadrat
+        for (int dz = -loadRadius; dz <= loadRadius; ++dz) {
+            for (int dx = -loadRadius; dx <= loadRadius; ++dx) {
+                const ChunkKey ck{ center.cx + dx, center.cz + dz };
+                if (InSquare(ck, streamCenter_, streamLoadRadius_)) continue;
 
                 auto ch = chunks_.GetOrCreate(ck);
-                EnqueueGenerate(ch);
+                // Nur neue Chunks (noch ohne Mesh); geladene aus dem Hysterese-Ring
+                // stellt der LOD-Durchlauf unten um und meshed sie dabei neu
+                if (ch->State() == ChunkState::Empty) ch->SetLod(LodFor(ck, center, lodDistance_));
+                EnqueueGenerate(ch, prioritizedGeneration_ ? GenPriority(ck, center) : 0);
                 // meshen passiert nach generate
             }
         }
 
-        // Entladen (sehr simpel): alles, was nicht in wanted ist, entfernen
+        // LOD-Stufen der schon geladenen Chunks an das neue Center anpassen
+        if ((lodDistance_ > 0 && !(center == streamCenter_)) || lodChanged_) {
+            for (int dz = -loadRadius; dz <= loadRadius; ++dz) {
+                for (int dx = -loadRadius; dx <= loadRadius; ++dx) {
+                    const ChunkKey ck{ center.cx + dx, center.cz + dz };
+                    auto ch = chunks_.GetChunk(ck);
+                    const int lod = LodFor(ck, center, lodDistance_);
+                    if (!ch || ch->Lod() == lod) continue;
+                    ch->SetLod(lod);
+                    ch->MarkDirtyMesh();
+                    RequestRemesh(ch);
+                }
+            }
+            lodChanged_ = false;
+        }
+
+        // Entladen: altes Entlade-Quadrat minus neues Entlade-Quadrat.
+        // Entlade-Radius > Lade-Radius (Hysterese): an einer Chunk-Grenze hin und her
+        // laufen laedt/entlaedt nicht staendig dieselbe Reihe.
         // (Spter: LRU + Persistenz + Sanftes Unload)
-        for (auto& ch : chunks_.SnapshotAll()) {
-            if (!ch) continue;
-            if (wanted.find(ch->Key()) == wanted.end()) {
-                chunks_.Remove(ch->Key());
+        const int oldUnload = streamUnloadRadius_;
+        for (int dz = -oldUnload; dz <= oldUnload; ++dz) {
+            for (int dx = -oldUnload; dx <= oldUnload; ++dx) {
+                const ChunkKey ck{ streamCenter_.cx + dx, streamCenter_.cz + dz };
+                if (InSquare(ck, center, unloadRadius)) continue;
+                UnloadChunk(ck);
             }
         }
+
+        // Jobs entladener Chunks verwerfen: alles ausserhalb des neuen Entlade-Quadrats
+        // ist nicht mehr in der Map (laufende Jobs pruefen den Unloading-State)
+        if (prioritizedGeneration_ && oldUnload >= 0) {
+            auto gone = [&](JobQueue::Tag tag) { return !InSquare(UnpackChunkKey(tag), center, unloadRadius); };
+            genQ_.CancelIf(gone);
+            meshQ_.CancelIf(gone);
+        }
+
+        streamCenter_ = center;
+        streamLoadRadius_ = loadRadius;
+        streamUnloadRadius_ = unloadRadius;
     }
 
 } // namespace BrickWorlds::Voxel